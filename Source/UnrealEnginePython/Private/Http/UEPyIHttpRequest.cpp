@@ -2,6 +2,7 @@
 #include "UEPyIHttpRequest.h"
 
 #include "UEPyIHttpResponse.h"
+#include "UEPyAsyncLoop.h"
 
 #include "Runtime/Online/HTTP/Public/HttpManager.h"
 
@@ -207,6 +208,50 @@ static PyObject *py_ue_ihttp_request_bind_on_process_request_complete(ue_PyIHttp
 	Py_RETURN_NONE;
 }
 
+#if PY_MAJOR_VERSION >= 3
+void FPythonSmartHttpDelegate::OnRequestCompleteFuture(FHttpRequestPtr request, FHttpResponsePtr response, bool successful)
+{
+	FScopePythonGIL gil;
+
+	if (!successful || !response.IsValid())
+	{
+		py_ue_async_reject(py_callable, "HTTP request failed");
+		return;
+	}
+
+	PyObject *py_response = py_ue_new_ihttp_response(response.Get());
+	if (!py_response)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+	py_ue_async_resolve(py_callable, py_response);
+	Py_DECREF(py_response);
+}
+
+static PyObject *py_ue_ihttp_request_process_request_async(ue_PyIHttpRequest *self, PyObject * args)
+{
+	PyObject *py_future = py_ue_async_new_future();
+	if (!py_future)
+		return nullptr;
+
+	TSharedRef<FPythonSmartHttpDelegate> py_delegate = MakeShareable(new FPythonSmartHttpDelegate);
+	py_delegate->SetPyCallable(py_future);
+	py_delegate->SetPyHttpRequest(self);
+	// replaces the delegate set by bind_on_process_request_complete()
+	self->http_request->OnProcessRequestComplete().BindSP(py_delegate, &FPythonSmartHttpDelegate::OnRequestCompleteFuture);
+
+	self->on_process_request_complete = py_delegate;
+
+	if (!self->http_request->ProcessRequest())
+	{
+		py_ue_async_reject(py_future, "unable to start HTTP request");
+	}
+
+	return py_future;
+}
+#endif
+
 static PyObject *py_ue_ihttp_request_bind_on_request_progress(ue_PyIHttpRequest *self, PyObject * args)
 {
 
@@ -240,6 +285,9 @@ static PyMethodDef ue_PyIHttpRequest_methods[] = {
 	{ "get_status", (PyCFunction)py_ue_ihttp_request_get_status, METH_VARARGS, "" },
 	{ "get_verb", (PyCFunction)py_ue_ihttp_request_get_verb, METH_VARARGS, "" },
 	{ "process_request", (PyCFunction)py_ue_ihttp_request_process_request, METH_VARARGS, "" },
+#if PY_MAJOR_VERSION >= 3
+	{ "process_request_async", (PyCFunction)py_ue_ihttp_request_process_request_async, METH_VARARGS, "" },
+#endif
 	{ "set_content", (PyCFunction)py_ue_ihttp_request_set_content, METH_VARARGS, "" },
 	{ "set_header", (PyCFunction)py_ue_ihttp_request_set_header, METH_VARARGS, "" },
 	{ "set_url", (PyCFunction)py_ue_ihttp_request_set_url, METH_VARARGS, "" },
@@ -26,6 +26,10 @@ class FPythonSmartHttpDelegate : public FPythonSmartDelegate
 public:
 	void OnRequestComplete(FHttpRequestPtr request, FHttpResponsePtr response, bool successful);
 	void OnRequestProgress(FHttpRequestPtr request, int32 sent, int32 received);
+#if PY_MAJOR_VERSION >= 3
+	// the callable is an asyncio future
+	void OnRequestCompleteFuture(FHttpRequestPtr request, FHttpResponsePtr response, bool successful);
+#endif
 
 	void SetPyHttpRequest(ue_PyIHttpRequest *request)
 	{
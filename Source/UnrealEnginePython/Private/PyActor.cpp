@@ -2,6 +2,7 @@
 
 #include "PyActor.h"
 #include "UEPyModule.h"
+#include "PythonTickManager.h"
 
 APyActor::APyActor()
 {
@@ -9,6 +10,9 @@ APyActor::APyActor()
 
 	PythonTickForceDisabled = false;
 	PythonDisableAutoBinding = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLOD = false;
 
 }
 
@@ -69,10 +73,14 @@ void APyActor::PreInitializeComponents()
 	PyObject_SetAttrString(py_actor_instance, (char*)"uobject", (PyObject *)py_uobject);
 
 
-	if (!PyObject_HasAttrString(py_actor_instance, (char *)"tick") || PythonTickForceDisabled)
+	if (!PyObject_HasAttrString(py_actor_instance, (char *)"tick") || PythonTickForceDisabled || PythonTickBatched)
 	{
 		SetActorTickEnabled(false);
 	}
+	else if (PythonTickInterval > 0)
+	{
+		PrimaryActorTick.TickInterval = PythonTickInterval;
+	}
 
 	if (!PythonDisableAutoBinding)
 		ue_autobind_events_for_pyclass(py_uobject, py_actor_instance);
@@ -124,6 +132,9 @@ void APyActor::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickForceDisabled)
+		FPythonTickManager::Get()->Register(this, py_actor_instance, PrimaryActorTick.TickGroup, PythonTickInterval, PythonTickLOD);
+
 	if (!PyObject_HasAttrString(py_actor_instance, (char *)"begin_play"))
 		return;
 
@@ -168,6 +179,9 @@ void APyActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched)
+		FPythonTickManager::Get()->Unregister(this);
+
 	if (PyObject_HasAttrString(py_actor_instance, (char *)"end_play"))
 	{
 		PyObject *ep_ret = PyObject_CallMethod(py_actor_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
@@ -1,6 +1,7 @@
 
 #include "PyPawn.h"
 #include "UEPyModule.h"
+#include "PythonTickManager.h"
 
 APyPawn::APyPawn()
 {
@@ -8,6 +9,9 @@ APyPawn::APyPawn()
 
 	PythonTickForceDisabled = false;
 	PythonDisableAutoBinding = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLOD = false;
 	
 }
 
@@ -85,9 +89,12 @@ void APyPawn::PreInitializeComponents()
 
 
 	// disable ticking if not required
-	if (!PyObject_HasAttrString(py_pawn_instance, (char *)"tick") || PythonTickForceDisabled) {
+	if (!PyObject_HasAttrString(py_pawn_instance, (char *)"tick") || PythonTickForceDisabled || PythonTickBatched) {
 		SetActorTickEnabled(false);
 	}
+	else if (PythonTickInterval > 0) {
+		PrimaryActorTick.TickInterval = PythonTickInterval;
+	}
 
 	if (!PythonDisableAutoBinding)
 		ue_autobind_events_for_pyclass(py_uobject, py_pawn_instance);
@@ -115,6 +122,9 @@ void APyPawn::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickForceDisabled)
+		FPythonTickManager::Get()->Register(this, py_pawn_instance, PrimaryActorTick.TickGroup, PythonTickInterval, PythonTickLOD);
+
 	if (!PyObject_HasAttrString(py_pawn_instance, (char *)"begin_play"))
 		return;
 
@@ -153,6 +163,9 @@ void APyPawn::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched)
+		FPythonTickManager::Get()->Unregister(this);
+
 	if (PyObject_HasAttrString(py_pawn_instance, (char *)"end_play")) {
 		PyObject *ep_ret = PyObject_CallMethod(py_pawn_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
 
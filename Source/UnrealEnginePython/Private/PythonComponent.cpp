@@ -1,6 +1,7 @@
 
 #include "PythonComponent.h"
 #include "UEPyModule.h"
+#include "PythonTickManager.h"
 
 UPythonComponent::UPythonComponent()
 {
@@ -13,6 +14,9 @@ UPythonComponent::UPythonComponent()
 
 	PythonTickForceDisabled = false;
 	PythonDisableAutoBinding = false;
+	PythonTickBatched = false;
+	PythonTickInterval = 0;
+	PythonTickLOD = false;
 	PythonTickEnableGenerator = false;
 
 	bWantsInitializeComponent = true;
@@ -76,11 +80,15 @@ void UPythonComponent::InitializePythonComponent()
 
 
 	// disable ticking if no tick method is exposed
-	if (!PyObject_HasAttrString(py_component_instance, (char *)"tick") || PythonTickForceDisabled)
+	if (!PyObject_HasAttrString(py_component_instance, (char *)"tick") || PythonTickForceDisabled || (PythonTickBatched && !PythonTickEnableGenerator))
 	{
 		PrimaryComponentTick.bCanEverTick = false;
 		PrimaryComponentTick.SetTickFunctionEnable(false);
 	}
+	else if (PythonTickInterval > 0)
+	{
+		PrimaryComponentTick.TickInterval = PythonTickInterval;
+	}
 
 	if (!PythonDisableAutoBinding)
 		ue_autobind_events_for_pyclass(py_uobject, py_component_instance);
@@ -118,6 +126,9 @@ void UPythonComponent::BeginPlay()
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched && !PythonTickEnableGenerator && !PythonTickForceDisabled)
+		FPythonTickManager::Get()->Register(this, py_component_instance, PrimaryComponentTick.TickGroup, PythonTickInterval, PythonTickLOD);
+
 	if (!PyObject_HasAttrString(py_component_instance, (char *)"begin_play"))
 	{
 		return;
@@ -139,6 +150,9 @@ void UPythonComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 
 	FScopePythonGIL gil;
 
+	if (PythonTickBatched)
+		FPythonTickManager::Get()->Unregister(this);
+
 	if (PyObject_HasAttrString(py_component_instance, (char *)"end_play"))
 	{
 		PyObject *ep_ret = PyObject_CallMethod(py_component_instance, (char *)"end_play", (char*)"i", (int)EndPlayReason);
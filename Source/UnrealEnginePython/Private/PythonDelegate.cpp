@@ -2,11 +2,38 @@
 #include "PythonDelegate.h"
 #include "UEPyModule.h"
 #include "UEPyCallable.h"
+#include "UEPyPropertyConverters.h"
+#include "Misc/CoreDelegates.h"
+
+// delegates in coalescing mode with events waiting for the end of the frame
+static TArray<TWeakObjectPtr<UPythonDelegate>> CoalescedDelegates;
+static FDelegateHandle CoalescedDelegatesHandle;
+
+void UPythonDelegate::FlushCoalescedDelegates()
+{
+	if (CoalescedDelegates.Num() == 0)
+		return;
+
+	FScopePythonGIL gil;
+
+	// callables can fire other events, they will be delivered in the next frame
+	TArray<TWeakObjectPtr<UPythonDelegate>> Delegates = MoveTemp(CoalescedDelegates);
+	CoalescedDelegates.Empty();
+	for (TWeakObjectPtr<UPythonDelegate> &Delegate : Delegates)
+	{
+		if (UPythonDelegate *py_delegate = Delegate.Get())
+			py_delegate->FlushPendingEvents();
+	}
+}
 
 UPythonDelegate::UPythonDelegate()
 {
 	py_callable = nullptr;
 	signature_set = false;
+	py_args_cache = nullptr;
+	args_cache_in_use = false;
+	coalesce = false;
+	py_pending_events = nullptr;
 }
 
 void UPythonDelegate::SetPyCallable(PyObject *callable)
@@ -20,6 +47,74 @@ void UPythonDelegate::SetSignature(UFunction *original_signature)
 {
 	signature = original_signature;
 	signature_set = true;
+
+	params.Empty();
+	TFieldIterator<UProperty> PArgs(signature);
+	for (; PArgs && params.Num() < signature->NumParms && ((PArgs->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm); ++PArgs)
+	{
+		FPyDelegateParam Param;
+		Param.Property = *PArgs;
+		Param.ToPython = ue_py_get_property_converter(*PArgs).ToPython;
+		params.Add(Param);
+	}
+}
+
+void UPythonDelegate::SetCoalesce(bool enabled)
+{
+	if (coalesce && !enabled)
+		FlushPendingEvents();
+	coalesce = enabled;
+}
+
+PyObject *UPythonDelegate::BuildArgs(void *Parms, bool reuse)
+{
+	// the empty tuple is a singleton
+	if (params.Num() == 0)
+		return PyTuple_New(0);
+
+	PyObject *py_args = nullptr;
+	if (reuse && !args_cache_in_use)
+	{
+		if (!py_args_cache)
+		{
+			py_args_cache = PyTuple_New(params.Num());
+			if (!py_args_cache)
+				return nullptr;
+		}
+		if (Py_REFCNT(py_args_cache) == 1)
+		{
+			py_args = py_args_cache;
+			Py_INCREF(py_args);
+			args_cache_in_use = true;
+		}
+	}
+
+	if (!py_args)
+	{
+		py_args = PyTuple_New(params.Num());
+		if (!py_args)
+			return nullptr;
+	}
+
+	for (int32 i = 0; i < params.Num(); i++)
+	{
+		PyObject *arg = params[i].ToPython(params[i].Property, (uint8 *)Parms, 0);
+		if (!arg)
+		{
+			if (py_args == py_args_cache)
+			{
+				// the items set so far are released by the tuple
+				Py_DECREF(py_args_cache);
+				py_args_cache = nullptr;
+				args_cache_in_use = false;
+			}
+			Py_DECREF(py_args);
+			return nullptr;
+		}
+		PyTuple_SET_ITEM(py_args, i, arg);
+	}
+
+	return py_args;
 }
 
 void UPythonDelegate::ProcessEvent(UFunction *function, void *Parms)
@@ -30,31 +125,60 @@ void UPythonDelegate::ProcessEvent(UFunction *function, void *Parms)
 
 	FScopePythonGIL gil;
 
-	PyObject *py_args = nullptr;
+	if (coalesce)
+	{
+		// parameters are only valid during the broadcast, so they are converted immediately
+		PyObject *py_args = BuildArgs(Parms, false);
+		if (!py_args)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+
+		if (!py_pending_events)
+		{
+			py_pending_events = PyList_New(0);
+			CoalescedDelegates.Add(this);
+			if (!CoalescedDelegatesHandle.IsValid())
+				CoalescedDelegatesHandle = FCoreDelegates::OnEndFrame.AddStatic(&UPythonDelegate::FlushCoalescedDelegates);
+		}
+		if (PyList_Append(py_pending_events, py_args) < 0)
+			unreal_engine_py_log_error();
+		Py_DECREF(py_args);
+		return;
+	}
 
-	if (signature_set)
+	PyObject *py_args = BuildArgs(Parms, true);
+	if (!py_args)
 	{
-		py_args = PyTuple_New(signature->NumParms);
-		Py_ssize_t argn = 0;
+		unreal_engine_py_log_error();
+		return;
+	}
+
+	PyObject *ret = PyObject_CallObject(py_callable, py_args);
 
-		TFieldIterator<UProperty> PArgs(signature);
-		for (; PArgs && argn < signature->NumParms && ((PArgs->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm); ++PArgs)
+	if (py_args == py_args_cache && args_cache_in_use)
+	{
+		args_cache_in_use = false;
+		// the callee kept a reference to the tuple, a new one will be allocated on the next broadcast
+		if (Py_REFCNT(py_args_cache) > 2)
 		{
-			UProperty *prop = *PArgs;
-			PyObject *arg = ue_py_convert_property(prop, (uint8 *)Parms, 0);
-			if (!arg)
+			Py_DECREF(py_args_cache);
+			py_args_cache = nullptr;
+		}
+		else
+		{
+			// do not keep the arguments alive until the next broadcast
+			for (int32 i = 0; i < params.Num(); i++)
 			{
-				unreal_engine_py_log_error();
-				Py_DECREF(py_args);
-				return;
+				PyObject *arg = PyTuple_GET_ITEM(py_args, i);
+				PyTuple_SET_ITEM(py_args, i, nullptr);
+				Py_XDECREF(arg);
 			}
-			PyTuple_SetItem(py_args, argn, arg);
-			argn++;
 		}
 	}
+	Py_DECREF(py_args);
 
-	PyObject *ret = PyObject_CallObject(py_callable, py_args);
-	Py_XDECREF(py_args);
 	if (!ret)
 	{
 		unreal_engine_py_log_error();
@@ -74,6 +198,26 @@ void UPythonDelegate::ProcessEvent(UFunction *function, void *Parms)
 	Py_DECREF(ret);
 }
 
+void UPythonDelegate::FlushPendingEvents()
+{
+	if (!py_pending_events)
+		return;
+
+	FScopePythonGIL gil;
+
+	PyObject *py_events = py_pending_events;
+	py_pending_events = nullptr;
+
+	PyObject *ret = PyObject_CallFunctionObjArgs(py_callable, py_events, nullptr);
+	Py_DECREF(py_events);
+	if (!ret)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+	Py_DECREF(ret);
+}
+
 void UPythonDelegate::PyFakeCallable()
 {
 }
@@ -114,6 +258,8 @@ UPythonDelegate::~UPythonDelegate()
 	FScopePythonGIL gil;
 
 	Py_XDECREF(py_callable);
+	Py_XDECREF(py_args_cache);
+	Py_XDECREF(py_pending_events);
 #if defined(UEPY_MEMORY_DEBUG)
 	UE_LOG(LogPython, Warning, TEXT("PythonDelegate %p callable XDECREF'ed"), this);
 #endif
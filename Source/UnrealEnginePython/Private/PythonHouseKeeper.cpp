@@ -1,11 +1,30 @@
 
 #include "PythonHouseKeeper.h"
+#include "Containers/Ticker.h"
+#include "UEPyCallable.h"
 
 void FUnrealEnginePythonHouseKeeper::AddReferencedObjects(FReferenceCollector& InCollector)
 {
     InCollector.AddReferencedObjects(PythonTrackedObjects);
 }
 
+FUnrealEnginePythonHouseKeeper::FPythonDelegateKey::FPythonDelegateKey(UObject *DelegateOwner, PyObject *PyCallable) : Owner(DelegateOwner)
+{
+    // same fields compared by UPythonDelegate::UsesPyCallable
+    ue_PyCallable *Callable = (ue_PyCallable *)PyCallable;
+    CallableFunction = Callable->u_function;
+    CallableTarget = Callable->u_target;
+}
+
+FUnrealEnginePythonHouseKeeper::FUnrealEnginePythonHouseKeeper() : bIncrementalGC(false), GCBudgetSeconds(0.001), GCMaxEntries(4096),
+    PendingDeadObjectsCursor(0), DelegatesCursor(-1), SlateDelegatesCursor(-1), GCScanned(0), GCFreed(0), GCSeconds(0), GCLastFrameSeconds(0)
+{
+    for (int32 Chunk = 0; Chunk < PyUObjectsMaxChunks; Chunk++)
+    {
+        PyUObjectsChunks[Chunk].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
 FUnrealEnginePythonHouseKeeper *FUnrealEnginePythonHouseKeeper::Get()
 {
     static FUnrealEnginePythonHouseKeeper *Singleton;
@@ -18,40 +37,214 @@ FUnrealEnginePythonHouseKeeper *FUnrealEnginePythonHouseKeeper::Get()
 #else
         FCoreUObjectDelegates::PostGarbageCollect.AddRaw(Singleton, &FUnrealEnginePythonHouseKeeper::RunGCDelegate);
 #endif
+        GUObjectArray.AddUObjectDeleteListener(Singleton);
     }
     return Singleton;
 }
 
 void FUnrealEnginePythonHouseKeeper::RunGCDelegate()
 {
+    if (bIncrementalGC)
+    {
+        // dead wrappers are already queued by the delete listener, only delegates need a scan
+        DelegatesCursor = PyDelegatesTracker.Num() - 1;
+        SlateDelegatesCursor = PySlateDelegatesTracker.Num() - 1;
+        return;
+    }
     FScopePythonGIL gil;
     RunGC();
 }
 
 int32 FUnrealEnginePythonHouseKeeper::RunGC()
 {
+    double StartTime = FPlatformTime::Seconds();
     int32 Garbaged = PyUObjectsGC();
     Garbaged += DelegatesGC();
+    GCScanned += UObjectPyMapping.Num() + PyDelegatesTracker.Num() + PySlateDelegatesTracker.Num() + Garbaged;
+    GCFreed += Garbaged;
+    GCLastFrameSeconds = FPlatformTime::Seconds() - StartTime;
+    GCSeconds += GCLastFrameSeconds;
     return Garbaged;
 }
 
-bool FUnrealEnginePythonHouseKeeper::IsValidPyUObject(ue_PyUObject *PyUObject)
+void FUnrealEnginePythonHouseKeeper::NotifyUObjectDeleted(const UObjectBase *Object, int32 Index)
 {
-    if (!PyUObject)
-        return false;
+    // only the objects with a wrapper are interesting (no lock needed for the lookup)
+    if (!bIncrementalGC || !FindPyUObjectByIndex(Index))
+        return;
 
-    UObject *Object = PyUObject->ue_object;
-    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
-    if (!Tracker)
+    FScopeLock Lock(&DeadObjectsLock);
+    DeadObjects.Add((UObject *)Object);
+}
+
+#if ENGINE_MINOR_VERSION >= 22
+void FUnrealEnginePythonHouseKeeper::OnUObjectArrayShutdown()
+{
+    GUObjectArray.RemoveUObjectDeleteListener(this);
+}
+#endif
+
+void FUnrealEnginePythonHouseKeeper::SetIncrementalGC(bool bEnabled, float BudgetMilliseconds, int32 MaxEntries)
+{
+    GCBudgetSeconds = FMath::Max(BudgetMilliseconds, 0.f) / 1000.0;
+    GCMaxEntries = FMath::Max(MaxEntries, 1);
+
+    if (bEnabled == bIncrementalGC)
+        return;
+
+    bIncrementalGC = bEnabled;
+    if (bEnabled)
     {
-        return false;
+        GCTickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FUnrealEnginePythonHouseKeeper::IncrementalGCTick));
     }
+    else
+    {
+        FTicker::GetCoreTicker().RemoveTicker(GCTickerHandle);
+        {
+            FScopeLock Lock(&DeadObjectsLock);
+            DeadObjects.Empty();
+        }
+        PendingDeadObjects.Empty();
+        PendingDeadObjectsCursor = 0;
+        DelegatesCursor = -1;
+        SlateDelegatesCursor = -1;
+        // the full scan catches everything left by the incremental mode
+        FScopePythonGIL gil;
+        RunGC();
+    }
+}
 
-    if (!Tracker->Owner.IsValid())
+bool FUnrealEnginePythonHouseKeeper::ReleaseDeadPyUObject(UObject *Object)
+{
+    // the object is gone, its pointer is only used as the key
+    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
+    // already released, or the memory has been reused by a new object with a wrapper
+    if (!Tracker || Tracker->Owner.IsValid(true))
         return false;
 
+    ue_PyUObject *PyUObject = Tracker->PyUObject;
+    bool bPythonOwned = Tracker->bPythonOwned;
+    UnregisterPyUObject(Object);
+    if (!bPythonOwned)
+        Py_DECREF((PyObject *)PyUObject);
     return true;
+}
+
+bool FUnrealEnginePythonHouseKeeper::IncrementalGCTick(float DeltaTime)
+{
+    if (PendingDeadObjectsCursor >= PendingDeadObjects.Num())
+    {
+        PendingDeadObjects.Reset();
+        PendingDeadObjectsCursor = 0;
+        FScopeLock Lock(&DeadObjectsLock);
+        Swap(PendingDeadObjects, DeadObjects);
+    }
+
+    if (PendingDeadObjects.Num() == 0 && DelegatesCursor < 0 && SlateDelegatesCursor < 0)
+        return true;
+
+    FScopePythonGIL gil;
+
+    double StartTime = FPlatformTime::Seconds();
+    int32 Entries = 0;
 
+    auto OutOfBudget = [&]()
+    {
+        // checking the time is not free, do it every 32 entries
+        return Entries >= GCMaxEntries || ((Entries & 31) == 0 && FPlatformTime::Seconds() - StartTime >= GCBudgetSeconds);
+    };
+
+    while (PendingDeadObjectsCursor < PendingDeadObjects.Num() && !OutOfBudget())
+    {
+        if (ReleaseDeadPyUObject(PendingDeadObjects[PendingDeadObjectsCursor++]))
+            GCFreed++;
+        Entries++;
+    }
+
+    while (DelegatesCursor >= 0 && !OutOfBudget())
+    {
+        if (DelegatesCursor < PyDelegatesTracker.Num())
+        {
+            FPythonDelegateTracker &Tracker = PyDelegatesTracker[DelegatesCursor];
+            if (!Tracker.Owner.IsValid(true))
+            {
+                // the swapped in tracker comes from the already scanned tail
+                RemoveDelegateTracker(DelegatesCursor);
+                GCFreed++;
+            }
+        }
+        DelegatesCursor--;
+        Entries++;
+    }
+
+    while (SlateDelegatesCursor >= 0 && !OutOfBudget())
+    {
+        if (SlateDelegatesCursor < PySlateDelegatesTracker.Num() && !PySlateDelegatesTracker[SlateDelegatesCursor].Owner.IsValid())
+        {
+            PySlateDelegatesTracker.RemoveAtSwap(SlateDelegatesCursor, 1, false);
+            GCFreed++;
+        }
+        SlateDelegatesCursor--;
+        Entries++;
+    }
+
+    GCScanned += Entries;
+    GCLastFrameSeconds = FPlatformTime::Seconds() - StartTime;
+    GCSeconds += GCLastFrameSeconds;
+
+    return true;
+}
+
+PyObject *FUnrealEnginePythonHouseKeeper::GetGCStats()
+{
+    int32 Pending = PendingDeadObjects.Num() - PendingDeadObjectsCursor;
+    {
+        FScopeLock Lock(&DeadObjectsLock);
+        Pending += DeadObjects.Num();
+    }
+
+    PyObject *py_stats = PyDict_New();
+    PyObject *py_value = PyBool_FromLong(bIncrementalGC ? 1 : 0);
+    PyDict_SetItemString(py_stats, "incremental", py_value);
+    Py_DECREF(py_value);
+    py_value = PyLong_FromUnsignedLongLong(GCScanned);
+    PyDict_SetItemString(py_stats, "scanned", py_value);
+    Py_DECREF(py_value);
+    py_value = PyLong_FromUnsignedLongLong(GCFreed);
+    PyDict_SetItemString(py_stats, "freed", py_value);
+    Py_DECREF(py_value);
+    py_value = PyFloat_FromDouble(GCSeconds * 1000.0);
+    PyDict_SetItemString(py_stats, "ms", py_value);
+    Py_DECREF(py_value);
+    py_value = PyFloat_FromDouble(GCLastFrameSeconds * 1000.0);
+    PyDict_SetItemString(py_stats, "last_ms", py_value);
+    Py_DECREF(py_value);
+    py_value = PyLong_FromLong(Pending);
+    PyDict_SetItemString(py_stats, "pending", py_value);
+    Py_DECREF(py_value);
+    py_value = PyLong_FromLong(UObjectPyMapping.Num());
+    PyDict_SetItemString(py_stats, "tracked", py_value);
+    Py_DECREF(py_value);
+    py_value = PyLong_FromLong(PyDelegatesTracker.Num());
+    PyDict_SetItemString(py_stats, "delegates", py_value);
+    Py_DECREF(py_value);
+    return py_stats;
+}
+
+void FUnrealEnginePythonHouseKeeper::SetPyUObjectByIndex(int32 Index, ue_PyUObject *PyUObject)
+{
+    // only the game thread writes, so no compare and swap is needed
+    int32 ChunkIndex = Index / PyUObjectsChunkSize;
+    FPyUObjectSlot *Chunk = PyUObjectsChunks[ChunkIndex].load(std::memory_order_relaxed);
+    if (!Chunk)
+    {
+        if (!PyUObject)
+            return;
+        // zeroed memory is a valid array of null (lock free) atomic pointers
+        Chunk = (FPyUObjectSlot *)FMemory::MallocZeroed(PyUObjectsChunkSize * sizeof(FPyUObjectSlot));
+        PyUObjectsChunks[ChunkIndex].store(Chunk, std::memory_order_release);
+    }
+    Chunk[Index % PyUObjectsChunkSize].store(PyUObject, std::memory_order_relaxed);
 }
 
 void FUnrealEnginePythonHouseKeeper::TrackUObject(UObject *Object)
@@ -77,16 +270,48 @@ void FUnrealEnginePythonHouseKeeper::UntrackUObject(UObject *Object)
 
 void FUnrealEnginePythonHouseKeeper::RegisterPyUObject(UObject *Object, ue_PyUObject *InPyUObject)
 {
-    UObjectPyMapping.Add(Object, FPythonUOjectTracker(Object, InPyUObject));
+    FPythonUOjectTracker &Tracker = UObjectPyMapping.Add(Object, FPythonUOjectTracker(Object, InPyUObject));
+    // the tracker weak pointer already allocated the serial number
+    InPyUObject->object_index = Tracker.ObjectIndex;
+    InPyUObject->object_serial = GUObjectArray.AllocateSerialNumber(Tracker.ObjectIndex);
+    SetPyUObjectByIndex(InPyUObject->object_index, InPyUObject);
 }
 
 void FUnrealEnginePythonHouseKeeper::UnregisterPyUObject(UObject *Object)
 {
+    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
+    if (!Tracker)
+        return;
+    // both the object and the wrapper could be already released, so only the index table is touched
+    if (FindPyUObjectByIndex(Tracker->ObjectIndex) == Tracker->PyUObject)
+    {
+        SetPyUObjectByIndex(Tracker->ObjectIndex, nullptr);
+    }
     UObjectPyMapping.Remove(Object);
 }
 
+void FUnrealEnginePythonHouseKeeper::ForgetPyUObject(ue_PyUObject *PyUObject)
+{
+    FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(PyUObject->ue_object);
+    if (Tracker && Tracker->PyUObject == PyUObject)
+    {
+        UnregisterPyUObject(PyUObject->ue_object);
+    }
+}
+
 ue_PyUObject *FUnrealEnginePythonHouseKeeper::GetPyUObject(UObject *Object)
 {
+    // fast path, no hash lookup for live objects
+    int32 Index = GUObjectArray.ObjectToIndex(Object);
+    if (Index >= 0)
+    {
+        ue_PyUObject *PyUObject = FindPyUObjectByIndex(Index);
+        if (PyUObject && PyUObject->ue_object == Object && IsValidPyUObject(PyUObject))
+        {
+            return PyUObject;
+        }
+    }
+
     FPythonUOjectTracker *Tracker = UObjectPyMapping.Find(Object);
     if (!Tracker)
     {
@@ -158,8 +383,7 @@ int32 FUnrealEnginePythonHouseKeeper::DelegatesGC()
         FPythonDelegateTracker &Tracker = PyDelegatesTracker[i];
         if (!Tracker.Owner.IsValid(true))
         {
-            Tracker.Delegate->RemoveFromRoot();
-            PyDelegatesTracker.RemoveAt(i);
+            RemoveDelegateTracker(i);
             Garbaged++;
         }
 
@@ -174,7 +398,7 @@ int32 FUnrealEnginePythonHouseKeeper::DelegatesGC()
         FPythonSWidgetDelegateTracker &Tracker = PySlateDelegatesTracker[i];
         if (!Tracker.Owner.IsValid())
         {
-            PySlateDelegatesTracker.RemoveAt(i);
+            PySlateDelegatesTracker.RemoveAtSwap(i, 1, false);
             Garbaged++;
         }
 
@@ -182,17 +406,70 @@ int32 FUnrealEnginePythonHouseKeeper::DelegatesGC()
     return Garbaged;
     }
 
+void FUnrealEnginePythonHouseKeeper::RemoveDelegateTracker(int32 Index)
+{
+    FPythonDelegateTracker &Tracker = PyDelegatesTracker[Index];
+    Tracker.Delegate->RemoveFromRoot();
+
+    TArray<int32, TInlineAllocator<1>> *Indices = PyDelegatesIndex.Find(Tracker.Key);
+    if (Indices)
+    {
+        Indices->RemoveSingle(Index);
+        if (Indices->Num() == 0)
+            PyDelegatesIndex.Remove(Tracker.Key);
+    }
+
+    int32 LastIndex = PyDelegatesTracker.Num() - 1;
+    if (Index != LastIndex)
+    {
+        // the last tracker is moved in the free slot
+        TArray<int32, TInlineAllocator<1>> *LastIndices = PyDelegatesIndex.Find(PyDelegatesTracker[LastIndex].Key);
+        if (LastIndices)
+        {
+            int32 Slot = LastIndices->Find(LastIndex);
+            if (Slot != INDEX_NONE)
+                (*LastIndices)[Slot] = Index;
+        }
+    }
+    PyDelegatesTracker.RemoveAtSwap(Index, 1, false);
+}
+
 UPythonDelegate *FUnrealEnginePythonHouseKeeper::FindDelegate(UObject *Owner, PyObject *PyCallable)
 {
-    for (int32 i = PyDelegatesTracker.Num() - 1; i >= 0; --i)
+    TArray<int32, TInlineAllocator<1>> *Indices = PyDelegatesIndex.Find(FPythonDelegateKey(Owner, PyCallable));
+    if (!Indices)
+        return nullptr;
+
+    // the most recently bound first, the owner pointer could belong to a dead object
+    for (int32 i = Indices->Num() - 1; i >= 0; --i)
     {
-        FPythonDelegateTracker &Tracker = PyDelegatesTracker[i];
-        if (Tracker.Owner.Get() == Owner && Tracker.Delegate->UsesPyCallable(PyCallable))
+        FPythonDelegateTracker &Tracker = PyDelegatesTracker[(*Indices)[i]];
+        if (Tracker.Owner.Get() == Owner)
             return Tracker.Delegate;
     }
     return nullptr;
 }
 
+bool FUnrealEnginePythonHouseKeeper::UntrackDelegate(UObject *Owner, PyObject *PyCallable)
+{
+    TArray<int32, TInlineAllocator<1>> *Indices = PyDelegatesIndex.Find(FPythonDelegateKey(Owner, PyCallable));
+    if (!Indices)
+        return false;
+
+    // same order of FindDelegate, so the delegate removed by ue_unbind_pyevent is released
+    for (int32 i = Indices->Num() - 1; i >= 0; --i)
+    {
+        int32 Index = (*Indices)[i];
+        if (PyDelegatesTracker[Index].Owner.Get() == Owner)
+        {
+            // the delegate is garbage collected once unrooted (it could be still running)
+            RemoveDelegateTracker(Index);
+            return true;
+        }
+    }
+    return false;
+}
+
 UPythonDelegate *FUnrealEnginePythonHouseKeeper::NewDelegate(UObject *Owner, PyObject *PyCallable, UFunction *Signature)
 {
     UPythonDelegate *Delegate = NewObject<UPythonDelegate>();
@@ -201,8 +478,8 @@ UPythonDelegate *FUnrealEnginePythonHouseKeeper::NewDelegate(UObject *Owner, PyO
     Delegate->SetPyCallable(PyCallable);
     Delegate->SetSignature(Signature);
 
-    FPythonDelegateTracker Tracker(Delegate, Owner);
-    PyDelegatesTracker.Add(Tracker);
+    FPythonDelegateKey Key(Owner, PyCallable);
+    PyDelegatesIndex.FindOrAdd(Key).Add(PyDelegatesTracker.Add(FPythonDelegateTracker(Delegate, Owner, Key)));
 
     return Delegate;
 }
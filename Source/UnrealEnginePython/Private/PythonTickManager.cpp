@@ -0,0 +1,431 @@
+// Copyright 20Tab S.r.l.
+
+#include "PythonTickManager.h"
+#include "UEPyModule.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/PlayerController.h"
+
+void FPythonBatchedTickFunction::ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent)
+{
+	// like actors, do not tick when only the viewports are updated
+	if (TickType == LEVELTICK_ViewportsOnly)
+		return;
+	Bucket->Tick(DeltaTime);
+}
+
+FString FPythonBatchedTickFunction::DiagnosticMessage()
+{
+	return FString::Printf(TEXT("FPythonBatchedTickFunction[%d]"), Bucket->Entries.Num());
+}
+
+void FPythonTickBucket::Tick(float DeltaTime)
+{
+	if (Entries.Num() == 0)
+		return;
+
+	FScopePythonGIL gil;
+
+	bTicking = true;
+
+	if (bBatchesDirty)
+		RebuildBatches();
+
+	FPythonTickManager *Manager = FPythonTickManager::Get();
+	Frame++;
+
+	// the view points are collected once per frame, only if the LOD is enabled
+	TArray<FVector, TInlineAllocator<4>> ViewLocations;
+	if (Manager->LODs.Num() > 0)
+	{
+		for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+		{
+			APlayerController *PlayerController = It->Get();
+			if (!PlayerController)
+				continue;
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	PyObject *py_delta = PyFloat_FromDouble(DeltaTime);
+
+	// entries registered by the scripts will tick in the next frame
+	int32 EntriesNum = Entries.Num();
+	for (int32 i = 0; i < EntriesNum; i++)
+	{
+		// the array could be reallocated by the scripts, the entry is not accessed after the call
+		FPythonTickEntry &Entry = Entries[i];
+
+		// checked before the tick, tick_batch-only entries must be compacted too
+		if (!Entry.Owner.IsValid())
+		{
+			bNeedsCompaction = true;
+			continue;
+		}
+
+		PyObject *py_tick = Entry.PyTick;
+		if (!py_tick)
+			continue;
+
+		float EntryDeltaTime = DeltaTime;
+		if (AActor *Actor = Entry.Actor.Get())
+			EntryDeltaTime *= Actor->CustomTimeDilation;
+		Entry.AccumulatedTime += EntryDeltaTime;
+
+		int32 Period = Entry.TickPeriod;
+		if (Period <= 0)
+			Period = Entry.bTickLOD ? GetLODPeriod(Entry, ViewLocations) : 1;
+
+		if ((Period > 1 && (Frame + Entry.Phase) % Period != 0) || Entry.AccumulatedTime < Entry.TickInterval - Entry.FirstTickOffset)
+		{
+			Manager->Skipped++;
+			continue;
+		}
+
+		// pass the time elapsed since the last tick
+		EntryDeltaTime = Entry.AccumulatedTime;
+		Entry.AccumulatedTime = 0;
+		Entry.FirstTickOffset = 0;
+		Manager->Ticked++;
+
+		Py_INCREF(py_tick);
+		PyObject *ret = nullptr;
+		if (EntryDeltaTime == DeltaTime)
+		{
+			ret = PyObject_CallFunctionObjArgs(py_tick, py_delta, nullptr);
+		}
+		else
+		{
+			ret = PyObject_CallFunction(py_tick, (char *)"f", EntryDeltaTime);
+		}
+		Py_DECREF(py_tick);
+
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+			continue;
+		}
+		Py_DECREF(ret);
+	}
+
+	for (int32 i = 0; i < Batches.Num(); i++)
+	{
+		PyObject *py_tick_batch = Batches[i].PyTickBatch;
+		PyObject *py_instances = Batches[i].PyInstances;
+		Py_INCREF(py_tick_batch);
+		Py_INCREF(py_instances);
+		PyObject *ret = PyObject_CallFunctionObjArgs(py_tick_batch, py_instances, py_delta, nullptr);
+		Py_DECREF(py_instances);
+		Py_DECREF(py_tick_batch);
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+			continue;
+		}
+		Py_DECREF(ret);
+	}
+
+	Py_DECREF(py_delta);
+
+	bTicking = false;
+
+	if (bNeedsCompaction)
+		Compact();
+}
+
+int32 FPythonTickBucket::GetLODPeriod(const FPythonTickEntry &Entry, const TArray<FVector, TInlineAllocator<4>> &ViewLocations) const
+{
+	AActor *Actor = Entry.Actor.Get();
+	if (!Actor || ViewLocations.Num() == 0)
+		return 1;
+
+	FVector Location = Actor->GetActorLocation();
+	float DistanceSquared = MAX_flt;
+	for (const FVector &ViewLocation : ViewLocations)
+	{
+		DistanceSquared = FMath::Min(DistanceSquared, FVector::DistSquared(Location, ViewLocation));
+	}
+
+	int32 Period = 1;
+	for (const TPair<float, int32> &LOD : FPythonTickManager::Get()->LODs)
+	{
+		if (DistanceSquared < LOD.Key)
+			break;
+		Period = LOD.Value;
+	}
+	return Period;
+}
+
+void FPythonTickBucket::RebuildBatches()
+{
+	for (FPythonTickBatch &Batch : Batches)
+	{
+		Py_DECREF(Batch.PyTickBatch);
+		Py_DECREF(Batch.PyInstances);
+	}
+	Batches.Reset();
+
+	// group the instances by python class
+	TArray<PyTypeObject *> Types;
+	TArray<TArray<PyObject *>> Instances;
+	TArray<PyObject *> TickBatches;
+	for (FPythonTickEntry &Entry : Entries)
+	{
+		if (!Entry.PyTickBatch || !Entry.Owner.IsValid())
+			continue;
+		int32 Index = Types.Find(Py_TYPE(Entry.PyInstance));
+		if (Index == INDEX_NONE)
+		{
+			Index = Types.Add(Py_TYPE(Entry.PyInstance));
+			Instances.AddDefaulted();
+			TickBatches.Add(Entry.PyTickBatch);
+		}
+		Instances[Index].Add(Entry.PyInstance);
+	}
+
+	for (int32 i = 0; i < Types.Num(); i++)
+	{
+		FPythonTickBatch Batch;
+		Batch.PyTickBatch = TickBatches[i];
+		Py_INCREF(Batch.PyTickBatch);
+		Batch.PyInstances = PyTuple_New(Instances[i].Num());
+		for (int32 j = 0; j < Instances[i].Num(); j++)
+		{
+			Py_INCREF(Instances[i][j]);
+			PyTuple_SetItem(Batch.PyInstances, j, Instances[i][j]);
+		}
+		Batches.Add(Batch);
+	}
+
+	bBatchesDirty = false;
+}
+
+void FPythonTickBucket::RemoveEntry(int32 Index)
+{
+	FPythonTickManager *Manager = FPythonTickManager::Get();
+	FPythonTickEntry &Entry = Entries[Index];
+
+	// unregistered entries are already removed from the maps
+	if (Entry.PyInstance && EntriesIndex.FindRef(Entry.Key) == Index)
+	{
+		EntriesIndex.Remove(Entry.Key);
+		Manager->OwnersBucket.Remove(Entry.Key);
+		if (Entry.PyTickBatch)
+			bBatchesDirty = true;
+	}
+	Py_XDECREF(Entry.PyInstance);
+	Py_XDECREF(Entry.PyTick);
+	Py_XDECREF(Entry.PyTickBatch);
+
+	int32 LastIndex = Entries.Num() - 1;
+	if (Index != LastIndex && Entries[LastIndex].PyInstance)
+	{
+		int32 *LastSlot = EntriesIndex.Find(Entries[LastIndex].Key);
+		if (LastSlot && *LastSlot == LastIndex)
+			*LastSlot = Index;
+	}
+	Entries.RemoveAtSwap(Index, 1, false);
+}
+
+void FPythonTickBucket::Compact()
+{
+	for (int32 i = Entries.Num() - 1; i >= 0; i--)
+	{
+		if (!Entries[i].PyInstance || !Entries[i].Owner.IsValid())
+			RemoveEntry(i);
+	}
+	bNeedsCompaction = false;
+}
+
+void FPythonTickBucket::Clear()
+{
+	while (Entries.Num() > 0)
+		RemoveEntry(Entries.Num() - 1);
+
+	for (FPythonTickBatch &Batch : Batches)
+	{
+		Py_DECREF(Batch.PyTickBatch);
+		Py_DECREF(Batch.PyInstances);
+	}
+	Batches.Empty();
+}
+
+FPythonTickManager *FPythonTickManager::Get()
+{
+	static FPythonTickManager *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FPythonTickManager();
+		FWorldDelegates::OnWorldCleanup.AddRaw(Singleton, &FPythonTickManager::OnWorldCleanup);
+	}
+	return Singleton;
+}
+
+FPythonTickBucket *FPythonTickManager::FindOrAddBucket(UWorld *World, ETickingGroup TickGroup)
+{
+	for (FPythonTickBucket *Bucket : Buckets)
+	{
+		if (Bucket->World == World && Bucket->TickGroup == TickGroup)
+			return Bucket;
+	}
+
+	FPythonTickBucket *Bucket = new FPythonTickBucket();
+	Bucket->World = World;
+	Bucket->TickGroup = TickGroup;
+	Bucket->bBatchesDirty = false;
+	Bucket->bTicking = false;
+	Bucket->bNeedsCompaction = false;
+	Bucket->Frame = 0;
+	Bucket->TickFunction.Bucket = Bucket;
+	Bucket->TickFunction.bCanEverTick = true;
+	Bucket->TickFunction.TickGroup = TickGroup;
+	Bucket->TickFunction.RegisterTickFunction(World->PersistentLevel);
+	Buckets.Add(Bucket);
+	return Bucket;
+}
+
+bool FPythonTickManager::Register(UObject *Owner, PyObject *PyInstance, ETickingGroup TickGroup, float TickInterval, bool bTickLOD)
+{
+	UWorld *World = Owner->GetWorld();
+	if (!World || !World->PersistentLevel)
+		return false;
+
+	PyObject *py_tick = nullptr;
+	PyObject *py_tick_batch = nullptr;
+	// the vectorized version wins
+	if (PyObject_HasAttrString((PyObject *)Py_TYPE(PyInstance), (char *)"tick_batch"))
+	{
+		py_tick_batch = PyObject_GetAttrString((PyObject *)Py_TYPE(PyInstance), (char *)"tick_batch");
+	}
+	else if (PyObject_HasAttrString(PyInstance, (char *)"tick"))
+	{
+		py_tick = PyObject_GetAttrString(PyInstance, (char *)"tick");
+	}
+	else
+	{
+		return false;
+	}
+
+	if (!py_tick && !py_tick_batch)
+	{
+		unreal_engine_py_log_error();
+		return false;
+	}
+
+	Unregister(Owner);
+
+	FPythonTickBucket *Bucket = FindOrAddBucket(World, TickGroup);
+
+	FPythonTickEntry Entry;
+	Entry.Key = Owner;
+	Entry.Owner = FWeakObjectPtr(Owner);
+	if (AActor *Actor = Cast<AActor>(Owner))
+	{
+		Entry.Actor = Actor;
+	}
+	else if (UActorComponent *Component = Cast<UActorComponent>(Owner))
+	{
+		Entry.Actor = Component->GetOwner();
+	}
+	Entry.PyInstance = PyInstance;
+	Py_INCREF(Entry.PyInstance);
+	Entry.PyTick = py_tick;
+	Entry.PyTickBatch = py_tick_batch;
+	Entry.TickInterval = FMath::Max(TickInterval, 0.f);
+	Entry.TickPeriod = 0;
+	Entry.bTickLOD = bTickLOD;
+	Entry.Phase = NextPhase++;
+	Entry.AccumulatedTime = 0;
+	// spread the first tick of the instances with the same interval across 8 slots
+	Entry.FirstTickOffset = Entry.TickInterval * (Entry.Phase % 8) / 8;
+
+	Bucket->EntriesIndex.Add(Owner, Bucket->Entries.Add(Entry));
+	if (py_tick_batch)
+		Bucket->bBatchesDirty = true;
+
+	OwnersBucket.Add(Owner, Bucket);
+	return true;
+}
+
+void FPythonTickManager::Unregister(UObject *Owner)
+{
+	FPythonTickBucket *Bucket = OwnersBucket.FindRef(Owner);
+	if (!Bucket)
+		return;
+
+	int32 *Index = Bucket->EntriesIndex.Find(Owner);
+	if (!Index)
+	{
+		OwnersBucket.Remove(Owner);
+		return;
+	}
+
+	if (!Bucket->bTicking)
+	{
+		Bucket->RemoveEntry(*Index);
+		return;
+	}
+
+	// called by a script while ticking, the entry is removed at the end of the frame
+	FPythonTickEntry &Entry = Bucket->Entries[*Index];
+	if (Entry.PyTickBatch)
+		Bucket->bBatchesDirty = true;
+	Py_CLEAR(Entry.PyInstance);
+	Py_CLEAR(Entry.PyTick);
+	Py_CLEAR(Entry.PyTickBatch);
+	Bucket->EntriesIndex.Remove(Owner);
+	OwnersBucket.Remove(Owner);
+	Bucket->bNeedsCompaction = true;
+}
+
+bool FPythonTickManager::SetSchedule(UObject *Owner, float TickInterval, int32 TickPeriod, bool bTickLOD)
+{
+	FPythonTickBucket *Bucket = OwnersBucket.FindRef(Owner);
+	if (!Bucket)
+		return false;
+
+	int32 *Index = Bucket->EntriesIndex.Find(Owner);
+	if (!Index)
+		return false;
+
+	FPythonTickEntry &Entry = Bucket->Entries[*Index];
+	Entry.TickInterval = FMath::Max(TickInterval, 0.f);
+	// not ticked yet
+	if (Entry.FirstTickOffset > 0)
+		Entry.FirstTickOffset = Entry.TickInterval * (Entry.Phase % 8) / 8;
+	Entry.TickPeriod = FMath::Max(TickPeriod, 0);
+	Entry.bTickLOD = bTickLOD;
+	return true;
+}
+
+void FPythonTickManager::SetLOD(const TArray<TPair<float, int32>> &InLODs)
+{
+	LODs.Empty(InLODs.Num());
+	for (const TPair<float, int32> &LOD : InLODs)
+	{
+		LODs.Add(TPair<float, int32>(LOD.Key * LOD.Key, FMath::Max(LOD.Value, 1)));
+	}
+	LODs.Sort([](const TPair<float, int32> &A, const TPair<float, int32> &B) { return A.Key < B.Key; });
+}
+
+void FPythonTickManager::OnWorldCleanup(UWorld *World, bool bSessionEnded, bool bCleanupResources)
+{
+	for (int32 i = Buckets.Num() - 1; i >= 0; i--)
+	{
+		FPythonTickBucket *Bucket = Buckets[i];
+		if (Bucket->World != World)
+			continue;
+
+		{
+			FScopePythonGIL gil;
+			Bucket->Clear();
+		}
+		Bucket->TickFunction.UnRegisterTickFunction();
+		delete Bucket;
+		Buckets.RemoveAtSwap(i);
+	}
+}
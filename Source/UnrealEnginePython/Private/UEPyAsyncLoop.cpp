@@ -0,0 +1,367 @@
+#include "UEPyAsyncLoop.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+#include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Misc/PackageName.h"
+#include "Engine/World.h"
+
+struct FPyAsyncDelay
+{
+	PyObject *py_future;
+	double Time;
+	// game time of the world, or the loop time (real seconds) if the world is not set
+	bool bWorldTime;
+	TWeakObjectPtr<UWorld> World;
+};
+
+class FPythonAsyncLoop
+{
+public:
+	FPythonAsyncLoop() : py_loop(nullptr), py_ready(nullptr), BudgetSeconds(0.002), LoopTime(0)
+	{
+	}
+
+	PyObject *GetLoop()
+	{
+		if (py_loop)
+			return py_loop;
+
+		PyObject *py_asyncio = PyImport_ImportModule("asyncio");
+		if (!py_asyncio)
+			return nullptr;
+
+		PyObject *loop = PyObject_CallMethod(py_asyncio, (char *)"new_event_loop", nullptr);
+		if (!loop)
+		{
+			Py_DECREF(py_asyncio);
+			return nullptr;
+		}
+
+		// asyncio.get_event_loop() will return it in the game thread
+		PyObject *ret = PyObject_CallMethod(py_asyncio, (char *)"set_event_loop", (char *)"O", loop);
+		Py_DECREF(py_asyncio);
+		if (!ret)
+		{
+			Py_DECREF(loop);
+			return nullptr;
+		}
+		Py_DECREF(ret);
+
+		py_loop = loop;
+		// private deque of the scheduled callbacks, used for checking if another step is required
+		py_ready = PyObject_GetAttrString(py_loop, "_ready");
+		if (!py_ready)
+			PyErr_Clear();
+
+		TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPythonAsyncLoop::Tick));
+		return py_loop;
+	}
+
+	bool Tick(float DeltaTime)
+	{
+		FScopePythonGIL gil;
+
+		LoopTime += DeltaTime;
+
+		if (NextFrameFutures.Num() > 0)
+		{
+			TArray<PyObject *> Futures = MoveTemp(NextFrameFutures);
+			NextFrameFutures.Empty();
+			for (PyObject *py_future : Futures)
+			{
+				py_ue_async_resolve(py_future, Py_None);
+				Py_DECREF(py_future);
+			}
+		}
+
+		for (int32 i = Delays.Num() - 1; i >= 0; i--)
+		{
+			FPyAsyncDelay &Delay = Delays[i];
+			double Now = LoopTime;
+			if (Delay.bWorldTime)
+			{
+				UWorld *World = Delay.World.Get();
+				if (!World)
+				{
+					PyObject *ret = PyObject_CallMethod(Delay.py_future, (char *)"cancel", nullptr);
+					if (!ret)
+						unreal_engine_py_log_error();
+					Py_XDECREF(ret);
+					Py_DECREF(Delay.py_future);
+					Delays.RemoveAtSwap(i);
+					continue;
+				}
+				Now = World->GetTimeSeconds();
+			}
+
+			if (Now >= Delay.Time)
+			{
+				PyObject *py_future = Delay.py_future;
+				Delays.RemoveAtSwap(i);
+				py_ue_async_resolve(py_future, Py_None);
+				Py_DECREF(py_future);
+			}
+		}
+
+		PyObject *py_running = PyObject_CallMethod(py_loop, (char *)"is_running", nullptr);
+		if (!py_running)
+		{
+			unreal_engine_py_log_error();
+			return true;
+		}
+		bool bRunning = PyObject_IsTrue(py_running) != 0;
+		Py_DECREF(py_running);
+		// run_until_complete() called by a script
+		if (bRunning)
+			return true;
+
+		double StartTime = FPlatformTime::Seconds();
+		for (;;)
+		{
+			// a single iteration of the loop (ready callbacks and expired timers), the selector does not block as stop() is ready
+			PyObject *py_stop = PyObject_GetAttrString(py_loop, "stop");
+			PyObject *ret = py_stop ? PyObject_CallMethod(py_loop, (char *)"call_soon", (char *)"O", py_stop) : nullptr;
+			Py_XDECREF(py_stop);
+			if (ret)
+			{
+				Py_DECREF(ret);
+				ret = PyObject_CallMethod(py_loop, (char *)"run_forever", nullptr);
+			}
+			if (!ret)
+			{
+				unreal_engine_py_log_error();
+				break;
+			}
+			Py_DECREF(ret);
+
+			if (!py_ready || PyObject_Length(py_ready) <= 0 || FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+				break;
+		}
+
+		return true;
+	}
+
+	// called with the GIL held before finalizing python (bFinalize false for brutal shutdowns)
+	void Shutdown(bool bFinalize)
+	{
+		if (TickerHandle.IsValid())
+		{
+			FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+			TickerHandle.Reset();
+		}
+
+		if (!bFinalize || !py_loop)
+			return;
+
+		for (PyObject *py_future : NextFrameFutures)
+		{
+			Py_DECREF(py_future);
+		}
+		NextFrameFutures.Empty();
+		for (FPyAsyncDelay &Delay : Delays)
+		{
+			Py_DECREF(Delay.py_future);
+		}
+		Delays.Empty();
+
+		// a running loop cannot be closed (shutdown requested by a script)
+		PyObject *py_running = PyObject_CallMethod(py_loop, (char *)"is_running", nullptr);
+		if (py_running && !PyObject_IsTrue(py_running))
+		{
+			PyObject *ret = PyObject_CallMethod(py_loop, (char *)"close", nullptr);
+			if (!ret)
+				unreal_engine_py_log_error();
+			Py_XDECREF(ret);
+		}
+		else if (!py_running)
+		{
+			unreal_engine_py_log_error();
+		}
+		Py_XDECREF(py_running);
+
+		Py_CLEAR(py_ready);
+		Py_CLEAR(py_loop);
+	}
+
+	PyObject *py_loop;
+	PyObject *py_ready;
+	double BudgetSeconds;
+	double LoopTime;
+	FDelegateHandle TickerHandle;
+
+	TArray<PyObject *> NextFrameFutures;
+	TArray<FPyAsyncDelay> Delays;
+};
+
+static FPythonAsyncLoop PythonAsyncLoop;
+
+PyObject *py_ue_async_new_future()
+{
+	PyObject *py_loop = PythonAsyncLoop.GetLoop();
+	if (!py_loop)
+		return nullptr;
+	return PyObject_CallMethod(py_loop, (char *)"create_future", nullptr);
+}
+
+void py_ue_async_resolve(PyObject *py_future, PyObject *py_value)
+{
+	PyObject *py_done = PyObject_CallMethod(py_future, (char *)"done", nullptr);
+	if (!py_done)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+	bool bDone = PyObject_IsTrue(py_done) != 0;
+	Py_DECREF(py_done);
+	if (bDone)
+		return;
+
+	PyObject *ret = PyObject_CallMethod(py_future, (char *)"set_result", (char *)"O", py_value);
+	if (!ret)
+		unreal_engine_py_log_error();
+	Py_XDECREF(ret);
+}
+
+void py_ue_async_reject(PyObject *py_future, const char *message)
+{
+	PyObject *py_done = PyObject_CallMethod(py_future, (char *)"done", nullptr);
+	if (!py_done)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+	bool bDone = PyObject_IsTrue(py_done) != 0;
+	Py_DECREF(py_done);
+	if (bDone)
+		return;
+
+	PyObject *py_exc = PyObject_CallFunction(PyExc_Exception, (char *)"s", message);
+	PyObject *ret = py_exc ? PyObject_CallMethod(py_future, (char *)"set_exception", (char *)"O", py_exc) : nullptr;
+	if (!ret)
+		unreal_engine_py_log_error();
+	Py_XDECREF(ret);
+	Py_XDECREF(py_exc);
+}
+
+void ue_python_shutdown_async_loop(bool bFinalize)
+{
+	PythonAsyncLoop.Shutdown(bFinalize);
+}
+
+PyObject *py_unreal_engine_get_event_loop(PyObject * self, PyObject * args)
+{
+	PyObject *py_loop = PythonAsyncLoop.GetLoop();
+	if (!py_loop)
+		return nullptr;
+	Py_INCREF(py_loop);
+	return py_loop;
+}
+
+PyObject *py_unreal_engine_set_event_loop_budget(PyObject * self, PyObject * args)
+{
+	float budget_ms;
+	if (!PyArg_ParseTuple(args, "f:set_event_loop_budget", &budget_ms))
+	{
+		return nullptr;
+	}
+
+	if (budget_ms < 0)
+		return PyErr_Format(PyExc_ValueError, "budget cannot be negative");
+
+	PythonAsyncLoop.BudgetSeconds = budget_ms / 1000.0;
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_next_frame(PyObject * self, PyObject * args)
+{
+	PyObject *py_future = py_ue_async_new_future();
+	if (!py_future)
+		return nullptr;
+
+	Py_INCREF(py_future);
+	PythonAsyncLoop.NextFrameFutures.Add(py_future);
+	return py_future;
+}
+
+PyObject *py_unreal_engine_delay(PyObject * self, PyObject * args)
+{
+	float seconds;
+	PyObject *py_obj = nullptr;
+	if (!PyArg_ParseTuple(args, "f|O:delay", &seconds, &py_obj))
+	{
+		return nullptr;
+	}
+
+	FPyAsyncDelay Delay;
+	Delay.bWorldTime = false;
+	Delay.Time = PythonAsyncLoop.LoopTime + seconds;
+
+	if (py_obj && py_obj != Py_None)
+	{
+		UObject *u_object = ue_py_check_type<UObject>(py_obj);
+		if (!u_object)
+			return PyErr_Format(PyExc_TypeError, "argument is not a UObject");
+
+		UWorld *World = u_object->GetWorld();
+		if (!World)
+			return PyErr_Format(PyExc_Exception, "unable to retrieve the world of %s", TCHAR_TO_UTF8(*u_object->GetName()));
+
+		Delay.bWorldTime = true;
+		Delay.World = World;
+		Delay.Time = World->GetTimeSeconds() + seconds;
+	}
+
+	PyObject *py_future = py_ue_async_new_future();
+	if (!py_future)
+		return nullptr;
+
+	Py_INCREF(py_future);
+	Delay.py_future = py_future;
+	PythonAsyncLoop.Delays.Add(Delay);
+	return py_future;
+}
+
+PyObject *py_unreal_engine_load_object_async(PyObject * self, PyObject * args)
+{
+	char *path;
+	if (!PyArg_ParseTuple(args, "s:load_object_async", &path))
+	{
+		return nullptr;
+	}
+
+	FString ObjectPath = UTF8_TO_TCHAR(path);
+	FString PackageName = FPackageName::ObjectPathToPackageName(ObjectPath);
+
+	PyObject *py_future = py_ue_async_new_future();
+	if (!py_future)
+		return nullptr;
+
+	// released by the completion delegate
+	Py_INCREF(py_future);
+	LoadPackageAsync(PackageName, FLoadPackageAsyncDelegate::CreateLambda([py_future, ObjectPath](const FName &LoadedPackageName, UPackage *Package, EAsyncLoadingResult::Type Result)
+	{
+		FScopePythonGIL gil;
+
+		UObject *u_object = nullptr;
+		if (Result == EAsyncLoadingResult::Succeeded && Package)
+		{
+			u_object = Package->GetName() == ObjectPath ? Package : StaticFindObject(UObject::StaticClass(), nullptr, *ObjectPath);
+		}
+
+		ue_PyUObject *py_obj = u_object ? ue_get_python_uobject(u_object) : nullptr;
+		if (py_obj)
+		{
+			py_ue_async_resolve(py_future, (PyObject *)py_obj);
+		}
+		else
+		{
+			py_ue_async_reject(py_future, TCHAR_TO_UTF8(*FString::Printf(TEXT("unable to load %s"), *ObjectPath)));
+		}
+		Py_DECREF(py_future);
+	}));
+
+	return py_future;
+}
+
+#endif
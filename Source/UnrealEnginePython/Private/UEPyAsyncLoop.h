@@ -0,0 +1,24 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+// asyncio event loop stepped by the core ticker
+
+PyObject *py_unreal_engine_get_event_loop(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_event_loop_budget(PyObject *, PyObject *);
+PyObject *py_unreal_engine_next_frame(PyObject *, PyObject *);
+PyObject *py_unreal_engine_delay(PyObject *, PyObject *);
+PyObject *py_unreal_engine_load_object_async(PyObject *, PyObject *);
+
+// returns a new future of the engine event loop (the loop is created if required)
+PyObject *py_ue_async_new_future();
+// no-op if the future is already done (or cancelled)
+void py_ue_async_resolve(PyObject *, PyObject *);
+void py_ue_async_reject(PyObject *, const char *);
+
+// removes the ticker and closes the loop (only if finalizing, the GIL must be held)
+void ue_python_shutdown_async_loop(bool);
+
+#endif
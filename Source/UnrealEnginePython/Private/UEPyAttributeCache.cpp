@@ -0,0 +1,215 @@
+#include "UEPyAttributeCache.h"
+
+#if WITH_EDITOR
+#include "Editor.h"
+#endif
+
+FUnrealEnginePythonAttributeCache *FUnrealEnginePythonAttributeCache::Get()
+{
+	static FUnrealEnginePythonAttributeCache *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonAttributeCache();
+		Singleton->Hits = 0;
+		Singleton->Misses = 0;
+		Singleton->Invalidations = 0;
+		// resolved fields could be garbaged (or reallocated at the same address)
+#if ENGINE_MINOR_VERSION >= 18
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(Singleton, &FUnrealEnginePythonAttributeCache::RunGCDelegate);
+#else
+		FCoreUObjectDelegates::PostGarbageCollect.AddRaw(Singleton, &FUnrealEnginePythonAttributeCache::RunGCDelegate);
+#endif
+#if WITH_EDITOR
+		Singleton->bEditorDelegatesRegistered = false;
+		// the cache is usually created at startup (by ue_site), before GEditor exists
+		Singleton->RegisterEditorDelegates();
+#if ENGINE_MINOR_VERSION >= 17
+		if (!Singleton->bEditorDelegatesRegistered)
+		{
+			FCoreDelegates::OnPostEngineInit.AddRaw(Singleton, &FUnrealEnginePythonAttributeCache::RegisterEditorDelegates);
+		}
+#endif
+#endif
+	}
+	return Singleton;
+}
+
+#if WITH_EDITOR
+void FUnrealEnginePythonAttributeCache::RegisterEditorDelegates()
+{
+	if (bEditorDelegatesRegistered || !GEditor)
+		return;
+	// blueprint compilation and reinstancing regenerate the class fields
+	GEditor->OnBlueprintCompiled().AddRaw(this, &FUnrealEnginePythonAttributeCache::Invalidate);
+	GEditor->OnObjectsReplaced().AddRaw(this, &FUnrealEnginePythonAttributeCache::OnObjectsReplaced);
+	bEditorDelegatesRegistered = true;
+}
+#endif
+
+UObject *FUnrealEnginePythonAttributeCache::GetScope(UObject *Object)
+{
+	// structs and enums expose their own fields, all the other objects expose the fields of their class
+	if (Object->IsA<UStruct>() || Object->IsA<UEnum>())
+	{
+		return Object;
+	}
+	return Object->GetClass();
+}
+
+static UPTRINT ue_py_attribute_scope_signature(UObject *Scope)
+{
+	if (UStruct *u_struct = Cast<UStruct>(Scope))
+	{
+		return (UPTRINT)u_struct->Children;
+	}
+	if (UEnum *u_enum = Cast<UEnum>(Scope))
+	{
+		return (UPTRINT)u_enum->NumEnums();
+	}
+	return 0;
+}
+
+PyObject *FUnrealEnginePythonAttributeCache::InternName(PyObject *AttrName)
+{
+#if PY_MAJOR_VERSION >= 3
+	// str subclasses cannot be interned
+	if (!PyUnicode_CheckExact(AttrName))
+		return nullptr;
+	Py_INCREF(AttrName);
+	PyUnicode_InternInPlace(&AttrName);
+	if (!PyUnicode_CHECK_INTERNED(AttrName))
+	{
+		Py_DECREF(AttrName);
+		return nullptr;
+	}
+#else
+	if (!PyString_CheckExact(AttrName))
+		return nullptr;
+	Py_INCREF(AttrName);
+	PyString_InternInPlace(&AttrName);
+	if (!PyString_CHECK_INTERNED(AttrName))
+	{
+		Py_DECREF(AttrName);
+		return nullptr;
+	}
+#endif
+	return AttrName;
+}
+
+FPyAttributeCacheEntry *FUnrealEnginePythonAttributeCache::Find(UObject *Scope, PyObject *InternedName)
+{
+	FPyAttributeScope *AttributeScope = Scopes.Find(Scope);
+	if (AttributeScope)
+	{
+		if (!AttributeScope->Owner.IsValid() || AttributeScope->Signature != ue_py_attribute_scope_signature(Scope))
+		{
+			ClearScope(*AttributeScope);
+			Scopes.Remove(Scope);
+			Invalidations++;
+		}
+		else if (FPyAttributeCacheEntry *Entry = AttributeScope->Entries.Find(InternedName))
+		{
+			Hits++;
+			return Entry;
+		}
+	}
+	Misses++;
+	return nullptr;
+}
+
+void FUnrealEnginePythonAttributeCache::Add(UObject *Scope, PyObject *InternedName, const FPyAttributeCacheEntry &Entry)
+{
+#if WITH_EDITOR
+	// fallback for engines without OnPostEngineInit (cheap, only on misses)
+	if (!bEditorDelegatesRegistered)
+		RegisterEditorDelegates();
+#endif
+
+	FPyAttributeScope *AttributeScope = Scopes.Find(Scope);
+	if (!AttributeScope)
+	{
+		AttributeScope = &Scopes.Add(Scope);
+		AttributeScope->Owner = FWeakObjectPtr(Scope);
+		AttributeScope->Signature = ue_py_attribute_scope_signature(Scope);
+	}
+
+	if (FPyAttributeCacheEntry *CurrentEntry = AttributeScope->Entries.Find(InternedName))
+	{
+		*CurrentEntry = Entry;
+		return;
+	}
+
+	// the cache owns a reference to the key, so the interned string cannot be recycled
+	Py_INCREF(InternedName);
+	AttributeScope->Entries.Add(InternedName, Entry);
+}
+
+void FUnrealEnginePythonAttributeCache::ClearScope(FPyAttributeScope &Scope)
+{
+	for (auto &Pair : Scope.Entries)
+	{
+		Py_DECREF(Pair.Key);
+	}
+	Scope.Entries.Empty();
+}
+
+void FUnrealEnginePythonAttributeCache::Invalidate()
+{
+	FScopePythonGIL gil;
+	for (auto &Pair : Scopes)
+	{
+		ClearScope(Pair.Value);
+	}
+	Scopes.Empty();
+	Invalidations++;
+}
+
+void FUnrealEnginePythonAttributeCache::RunGCDelegate()
+{
+	Invalidate();
+}
+
+#if WITH_EDITOR
+void FUnrealEnginePythonAttributeCache::OnObjectsReplaced(const TMap<UObject *, UObject *> &ReplacementMap)
+{
+	Invalidate();
+}
+#endif
+
+PyObject *FUnrealEnginePythonAttributeCache::GetStats()
+{
+	int32 Entries = 0;
+	for (auto &Pair : Scopes)
+	{
+		Entries += Pair.Value.Entries.Num();
+	}
+
+	PyObject *py_stats = PyDict_New();
+	PyObject *py_value = PyLong_FromUnsignedLongLong(Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Invalidations);
+	PyDict_SetItemString(py_stats, "invalidations", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromLong(Scopes.Num());
+	PyDict_SetItemString(py_stats, "scopes", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromLong(Entries);
+	PyDict_SetItemString(py_stats, "entries", py_value);
+	Py_DECREF(py_value);
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_get_attribute_cache_stats(PyObject * self, PyObject * args)
+{
+	return FUnrealEnginePythonAttributeCache::Get()->GetStats();
+}
+
+PyObject *py_unreal_engine_clear_attribute_cache(PyObject * self, PyObject * args)
+{
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+	Py_RETURN_NONE;
+}
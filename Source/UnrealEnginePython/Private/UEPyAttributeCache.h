@@ -0,0 +1,80 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+/*
+ * Per-UStruct cache of the attribute names resolved by ue_PyUObject_getattro.
+ *
+ * Names are keyed by their interned python string (pointer comparison), so a cache hit
+ * never touches FName, FindPropertyByName or FindFunction.
+ */
+
+enum class EPyAttributeKind : uint8
+{
+	// the name is not exposed by Unreal (the AttributeError is propagated)
+	Missing,
+	// PyObject_GenericGetAttr already resolves the name (methods, __dict__ items...)
+	PythonAttribute,
+	Property,
+	Function,
+	EnumValue,
+	UnknownEnumName,
+};
+
+struct FPyAttributeCacheEntry
+{
+	EPyAttributeKind Kind;
+	// true if PyObject_GenericGetAttr failed for this name on a plain unreal_engine.UObject
+	bool bTypeMiss;
+	UProperty *Property;
+	UFunction *Function;
+	int64 EnumValue;
+
+	FPyAttributeCacheEntry() : Kind(EPyAttributeKind::Missing), bTypeMiss(false), Property(nullptr), Function(nullptr), EnumValue(0)
+	{
+	}
+};
+
+class FUnrealEnginePythonAttributeCache
+{
+	struct FPyAttributeScope
+	{
+		FWeakObjectPtr Owner;
+		// changes whenever the fields of the scope are regenerated (class recompiled, property added...)
+		UPTRINT Signature;
+		TMap<PyObject *, FPyAttributeCacheEntry> Entries;
+	};
+
+public:
+	static FUnrealEnginePythonAttributeCache *Get();
+
+	// the UObject whose fields determine the attributes of a ue_PyUObject
+	static UObject *GetScope(UObject *Object);
+
+	// returns a new reference to the interned version of the name, or nullptr if the name is not cacheable
+	static PyObject *InternName(PyObject *AttrName);
+
+	FPyAttributeCacheEntry *Find(UObject *Scope, PyObject *InternedName);
+	void Add(UObject *Scope, PyObject *InternedName, const FPyAttributeCacheEntry &Entry);
+	void Invalidate();
+
+	PyObject *GetStats();
+
+private:
+	void RunGCDelegate();
+#if WITH_EDITOR
+	void RegisterEditorDelegates();
+	void OnObjectsReplaced(const TMap<UObject *, UObject *> &ReplacementMap);
+	bool bEditorDelegatesRegistered;
+#endif
+	void ClearScope(FPyAttributeScope &Scope);
+
+	TMap<UObject *, FPyAttributeScope> Scopes;
+
+	uint64 Hits;
+	uint64 Misses;
+	uint64 Invalidations;
+};
+
+PyObject *py_unreal_engine_get_attribute_cache_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_clear_attribute_cache(PyObject *, PyObject *);
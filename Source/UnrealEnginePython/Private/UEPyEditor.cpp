@@ -988,9 +988,24 @@ PyObject *py_unreal_engine_get_assets_by_filter(PyObject * self, PyObject * args
 	bool return_asset_data = false;
 	if (py_return_asset_data && PyObject_IsTrue(py_return_asset_data))
 		return_asset_data = true;
+
+	// loading the assets is the slowest part, the wrappers are created later with the GIL
+	TArray<UObject *> objects;
+	if (!return_asset_data)
+	{
+		Py_BEGIN_ALLOW_THREADS;
+		objects.Reserve(assets.Num());
+		for (const FAssetData &asset : assets)
+		{
+			objects.Add(asset.IsValid() ? asset.GetAsset() : nullptr);
+		}
+		Py_END_ALLOW_THREADS;
+	}
+
 	PyObject *assets_list = PyList_New(0);
-	for (FAssetData asset : assets)
+	for (int32 i = 0; i < assets.Num(); i++)
 	{
+		const FAssetData &asset = assets[i];
 		if (!asset.IsValid())
 			continue;
 		PyObject *ret = nullptr;
@@ -1000,7 +1015,7 @@ PyObject *py_unreal_engine_get_assets_by_filter(PyObject * self, PyObject * args
 		}
 		else
 		{
-			ret = (PyObject *)ue_get_python_uobject(asset.GetAsset());
+			ret = (PyObject *)ue_get_python_uobject(objects[i]);
 		}
 
 		if (ret)
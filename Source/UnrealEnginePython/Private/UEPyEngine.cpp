@@ -14,6 +14,7 @@
 
 #include "UnrealEngine.h"
 #include "Runtime/Engine/Classes/Engine/GameViewportClient.h"
+#include "UnrealClient.h"
 
 #if ENGINE_MINOR_VERSION >= 18
 #include "HAL/PlatformApplicationMisc.h"
@@ -27,6 +28,13 @@
 
 #include "Runtime/Slate/Public/Framework/Application/SlateApplication.h"
 #include "Runtime/CoreUObject/Public/UObject/UObjectIterator.h"
+#include "Wrappers/UEPyFObjectIterator.h"
+#include "PythonTickManager.h"
+#include "Wrappers/UEPyFGraphTask.h"
+#if PY_MAJOR_VERSION >= 3
+#include "UEPyAsyncLoop.h"
+#endif
+#include "Runtime/Core/Public/Containers/Ticker.h"
 
 PyObject *py_unreal_engine_log(PyObject * self, PyObject * args)
 {
@@ -291,7 +299,10 @@ PyObject *py_unreal_engine_load_package(PyObject * self, PyObject * args)
 		return nullptr;
 	}
 
-	UPackage *u_package = LoadPackage(nullptr, UTF8_TO_TCHAR(name), LOAD_None);
+	UPackage *u_package = nullptr;
+	Py_BEGIN_ALLOW_THREADS;
+	u_package = LoadPackage(nullptr, UTF8_TO_TCHAR(name), LOAD_None);
+	Py_END_ALLOW_THREADS;
 
 	if (!u_package)
 		return PyErr_Format(PyExc_Exception, "unable to load package %s", name);
@@ -352,7 +363,10 @@ PyObject *py_unreal_engine_load_class(PyObject * self, PyObject * args)
 	if (filename)
 		t_filename = UTF8_TO_TCHAR(filename);
 
-	UObject *u_class = StaticLoadObject(UClass::StaticClass(), NULL, UTF8_TO_TCHAR(name), t_filename);
+	UObject *u_class = nullptr;
+	Py_BEGIN_ALLOW_THREADS;
+	u_class = StaticLoadObject(UClass::StaticClass(), NULL, UTF8_TO_TCHAR(name), t_filename);
+	Py_END_ALLOW_THREADS;
 
 	if (!u_class)
 		return PyErr_Format(PyExc_Exception, "unable to find class %s", name);
@@ -373,7 +387,10 @@ PyObject *py_unreal_engine_load_enum(PyObject * self, PyObject * args)
 	if (filename)
 		t_filename = UTF8_TO_TCHAR(filename);
 
-	UObject *u_enum = StaticLoadObject(UEnum::StaticClass(), NULL, UTF8_TO_TCHAR(name), t_filename);
+	UObject *u_enum = nullptr;
+	Py_BEGIN_ALLOW_THREADS;
+	u_enum = StaticLoadObject(UEnum::StaticClass(), NULL, UTF8_TO_TCHAR(name), t_filename);
+	Py_END_ALLOW_THREADS;
 
 	if (!u_enum)
 		return PyErr_Format(PyExc_Exception, "unable to find enum %s", name);
@@ -410,7 +427,10 @@ PyObject *py_unreal_engine_load_struct(PyObject * self, PyObject * args)
 	if (filename)
 		t_filename = UTF8_TO_TCHAR(filename);
 
-	UObject *u_struct = StaticLoadObject(UScriptStruct::StaticClass(), NULL, UTF8_TO_TCHAR(name), t_filename);
+	UObject *u_struct = nullptr;
+	Py_BEGIN_ALLOW_THREADS;
+	u_struct = StaticLoadObject(UScriptStruct::StaticClass(), NULL, UTF8_TO_TCHAR(name), t_filename);
+	Py_END_ALLOW_THREADS;
 
 	if (!u_struct)
 		return PyErr_Format(PyExc_Exception, "unable to find struct %s", name);
@@ -446,7 +466,10 @@ PyObject *py_unreal_engine_load_object(PyObject * self, PyObject * args)
 	if (filename)
 		t_filename = UTF8_TO_TCHAR(filename);
 
-	UObject *u_object = StaticLoadObject(u_class, NULL, UTF8_TO_TCHAR(name), t_filename);
+	UObject *u_object = nullptr;
+	Py_BEGIN_ALLOW_THREADS;
+	u_object = StaticLoadObject(u_class, NULL, UTF8_TO_TCHAR(name), t_filename);
+	Py_END_ALLOW_THREADS;
 
 	if (!u_object)
 		return PyErr_Format(PyExc_Exception, "unable to load object %s", name);
@@ -541,6 +564,13 @@ PyObject *py_unreal_engine_get_delta_time(PyObject * self, PyObject * args)
 	return PyFloat_FromDouble(FApp::GetDeltaTime());
 }
 
+PyObject *py_unreal_engine_flush_coalesced_events(PyObject * self, PyObject * args)
+{
+	// errors raised by the callables are logged
+	UPythonDelegate::FlushCoalescedDelegates();
+	Py_RETURN_NONE;
+}
+
 
 PyObject *py_unreal_engine_find_object(PyObject * self, PyObject * args)
 {
@@ -721,45 +751,185 @@ PyObject *py_unreal_engine_tobject_iterator(PyObject * self, PyObject * args)
 	return ret;
 }
 
-PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject * self, PyObject * args)
+PyObject *py_unreal_engine_iter_objects(PyObject * self, PyObject * args, PyObject *kwargs)
 {
-	PyObject *py_callable;
-	int named_thread = (int)ENamedThreads::GameThread;
-	if (!PyArg_ParseTuple(args, "O|i:create_and_dispatch_when_ready", &py_callable, &named_thread))
+	FPyObjectIteratorFilter filter;
+	if (!py_ue_fobject_iterator_filter_args(args, kwargs, "|OzKK:iter_objects", filter))
+		return nullptr;
+
+	return py_ue_new_fobject_iterator(filter, false);
+}
+
+PyObject *py_unreal_engine_iter_classes(PyObject * self, PyObject * args)
+{
+	PyObject *py_parent = nullptr;
+	if (!PyArg_ParseTuple(args, "|O:iter_classes", &py_parent))
 	{
 		return NULL;
 	}
 
-	if (!PyCallable_Check(py_callable))
-		return PyErr_Format(PyExc_TypeError, "argument is not callable");
+	FPyObjectIteratorFilter filter;
+	filter.Class = UClass::StaticClass();
+	filter.ExcludeFlags = RF_NoFlags;
 
-	Py_INCREF(py_callable);
+	if (py_parent && py_parent != Py_None)
+	{
+		UClass *u_parent = ue_py_check_type<UClass>(py_parent);
+		if (!u_parent)
+		{
+			return PyErr_Format(PyExc_TypeError, "argument is not a UClass");
+		}
+		filter.ParentClass = u_parent;
+	}
 
+	return py_ue_new_fobject_iterator(filter, false);
+}
 
-	FGraphEventRef task = FFunctionGraphTask::CreateAndDispatchWhenReady([&]() {
-		FScopePythonGIL gil;
-		PyObject *ret = PyObject_CallObject(py_callable, nullptr);
-		if (ret)
+PyObject *py_unreal_engine_set_python_tick_lod(PyObject * self, PyObject * args)
+{
+	PyObject *py_lods;
+	if (!PyArg_ParseTuple(args, "O:set_python_tick_lod", &py_lods))
+	{
+		return NULL;
+	}
+
+	PyObject *py_iter = PyObject_GetIter(py_lods);
+	if (!py_iter)
+	{
+		return PyErr_Format(PyExc_TypeError, "argument is not iterable");
+	}
+
+	TArray<TPair<float, int32>> LODs;
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		float distance;
+		int period;
+		if (!PyTuple_Check(py_item) || !PyArg_ParseTuple(py_item, "fi", &distance, &period))
 		{
-			Py_DECREF(ret);
+			Py_DECREF(py_item);
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_TypeError, "items must be (distance, frames) tuples");
 		}
-		else
+		Py_DECREF(py_item);
+		if (distance < 0 || period < 1)
 		{
-			unreal_engine_py_log_error();
+			Py_DECREF(py_iter);
+			return PyErr_Format(PyExc_ValueError, "invalid tick LOD (%f, %d)", distance, period);
 		}
-		Py_DECREF(py_callable);
-	}, TStatId(), nullptr, (ENamedThreads::Type)named_thread);
+		LODs.Add(TPair<float, int32>(distance, period));
+	}
+	Py_DECREF(py_iter);
+
+	if (PyErr_Occurred())
+		return NULL;
 
+	FPythonTickManager::Get()->SetLOD(LODs);
+	Py_RETURN_NONE;
+}
 
-	Py_BEGIN_ALLOW_THREADS;
-	FTaskGraphInterface::Get().WaitUntilTaskCompletes(task);
-	Py_END_ALLOW_THREADS;
-	// TODO Implement signal triggering in addition to WaitUntilTaskCompletes
-	// FTaskGraphInterface::Get().TriggerEventWhenTaskCompletes
+PyObject *py_unreal_engine_set_python_tick_schedule(PyObject * self, PyObject * args)
+{
+	PyObject *py_obj;
+	float interval;
+	int period = 0;
+	PyObject *py_lod = nullptr;
+	if (!PyArg_ParseTuple(args, "Of|iO:set_python_tick_schedule", &py_obj, &interval, &period, &py_lod))
+	{
+		return NULL;
+	}
+
+	UObject *u_object = ue_py_check_type<UObject>(py_obj);
+	if (!u_object)
+		return PyErr_Format(PyExc_TypeError, "argument is not a UObject");
+
+	if (interval < 0 || period < 0)
+		return PyErr_Format(PyExc_ValueError, "invalid tick schedule");
+
+	if (!FPythonTickManager::Get()->SetSchedule(u_object, interval, period, py_lod && PyObject_IsTrue(py_lod)))
+		return PyErr_Format(PyExc_Exception, "%s is not ticked by the batched tick manager", TCHAR_TO_UTF8(*u_object->GetName()));
 
 	Py_RETURN_NONE;
 }
 
+PyObject *py_unreal_engine_get_python_tick_stats(PyObject * self, PyObject * args)
+{
+	FPythonTickManager *Manager = FPythonTickManager::Get();
+	PyObject *py_stats = PyDict_New();
+	PyObject *py_value = PyLong_FromLong(Manager->Num());
+	PyDict_SetItemString(py_stats, "registered", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Manager->Ticked);
+	PyDict_SetItemString(py_stats, "ticked", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Manager->Skipped);
+	PyDict_SetItemString(py_stats, "skipped", py_value);
+	Py_DECREF(py_value);
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject * self, PyObject * args)
+{
+	PyObject *py_callable;
+	int named_thread = (int)ENamedThreads::GameThread;
+	PyObject *py_prerequisites = nullptr;
+	if (!PyArg_ParseTuple(args, "O|iO:create_and_dispatch_when_ready", &py_callable, &named_thread, &py_prerequisites))
+	{
+		return NULL;
+	}
+
+	FGraphEventArray Prerequisites;
+	if (py_prerequisites && py_prerequisites != Py_None)
+	{
+		if (!py_ue_fgraph_task_sequence(py_prerequisites, Prerequisites, nullptr))
+			return NULL;
+	}
+
+	TArray<FPyGraphTaskStatePtr> Inputs;
+
+	if (PyCallable_Check(py_callable))
+		return py_ue_dispatch_fgraph_task(py_callable, Inputs, Prerequisites, (ENamedThreads::Type)named_thread);
+
+	// fan-out, a task for each callable
+	PyObject *py_callables = PySequence_Fast(py_callable, "argument is not callable or a sequence of callables");
+	if (!py_callables)
+		return NULL;
+
+	Py_ssize_t len = PySequence_Fast_GET_SIZE(py_callables);
+	for (Py_ssize_t i = 0; i < len; i++)
+	{
+		if (!PyCallable_Check(PySequence_Fast_GET_ITEM(py_callables, i)))
+		{
+			Py_DECREF(py_callables);
+			return PyErr_Format(PyExc_TypeError, "argument is not callable or a sequence of callables");
+		}
+	}
+
+	PyObject *py_tasks = PyList_New(len);
+	for (Py_ssize_t i = 0; i < len; i++)
+	{
+		PyList_SetItem(py_tasks, i, py_ue_dispatch_fgraph_task(PySequence_Fast_GET_ITEM(py_callables, i), Inputs, Prerequisites, (ENamedThreads::Type)named_thread));
+	}
+	Py_DECREF(py_callables);
+	return py_tasks;
+}
+
+PyObject *py_unreal_engine_when_all(PyObject * self, PyObject * args)
+{
+	PyObject *py_tasks;
+	int named_thread = (int)ENamedThreads::GameThread;
+	if (!PyArg_ParseTuple(args, "O|i:when_all", &py_tasks, &named_thread))
+	{
+		return NULL;
+	}
+
+	FGraphEventArray Prerequisites;
+	TArray<FPyGraphTaskStatePtr> Inputs;
+	if (!py_ue_fgraph_task_sequence(py_tasks, Prerequisites, &Inputs))
+		return NULL;
+
+	return py_ue_dispatch_fgraph_task(nullptr, Inputs, Prerequisites, (ENamedThreads::Type)named_thread);
+}
+
 
 #if PLATFORM_MAC
 PyObject *py_unreal_engine_main_thread_call(PyObject * self, PyObject * args)
@@ -818,26 +988,65 @@ PyObject *py_unreal_engine_get_resolution(PyObject *self, PyObject * args)
 	return Py_BuildValue("(ff)", GSystemResolution.ResX, GSystemResolution.ResY);
 }
 
-PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *self, PyObject * args)
+// FColor memory layout
+static const char *ue_py_screenshot_format = "BGRA8";
+
+// (data, width, height, format), data is the passed buffer (filled with the pixels) or a new bytearray
+static PyObject *ue_py_screenshot_to_raw(const TArray<FColor> &bitmap, int32 width, int32 height, PyObject *py_buffer)
 {
+	Py_ssize_t data_len = (Py_ssize_t)(bitmap.Num() * sizeof(FColor));
+	PyObject *py_data = nullptr;
 
-	if (!GEngine->GameViewport)
+	if (py_buffer)
 	{
-		Py_INCREF(Py_None);
-		return Py_None;
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_buffer, &py_buf, PyBUF_WRITABLE) < 0)
+			return nullptr;
+
+		if (py_buf.len < data_len)
+		{
+			PyBuffer_Release(&py_buf);
+			return PyErr_Format(PyExc_Exception, "buffer is not big enough (%d bytes required)", (int)data_len);
+		}
+
+		FMemory::Memcpy(py_buf.buf, bitmap.GetData(), data_len);
+		PyBuffer_Release(&py_buf);
+		py_data = py_buffer;
+		Py_INCREF(py_data);
+	}
+	else
+	{
+		py_data = PyByteArray_FromStringAndSize((const char *)bitmap.GetData(), data_len);
+		if (!py_data)
+			return nullptr;
 	}
 
+	return Py_BuildValue("(Niis)", py_data, width, height, ue_py_screenshot_format);
+}
+
+static PyObject *ue_py_get_viewport_screenshot(FViewport *viewport, PyObject * args, PyObject *kwargs, const char *format)
+{
 	PyObject *py_bool = nullptr;
-	bool as_int_list = false;
-	if (!PyArg_ParseTuple(args, "|O:get_viewport_screenshot", &py_bool))
+	PyObject *py_raw = nullptr;
+	PyObject *py_buffer = nullptr;
+
+	char *kwlist[] = {
+		(char *)"as_int_list",
+		(char *)"raw",
+		(char *)"buffer",
+		nullptr };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, format, kwlist, &py_bool, &py_raw, &py_buffer))
 	{
-		return NULL;
+		return nullptr;
 	}
 
-	if (py_bool && PyObject_IsTrue(py_bool))
-		as_int_list = true;
+	if (py_buffer == Py_None)
+		py_buffer = nullptr;
+
+	bool as_int_list = py_bool && PyObject_IsTrue(py_bool);
+	bool raw = py_buffer || (py_raw && PyObject_IsTrue(py_raw));
 
-	FViewport *viewport = GEngine->GameViewport->Viewport;
 	TArray<FColor> bitmap;
 
 	bool success = GetViewportScreenShot(viewport, bitmap);
@@ -848,6 +1057,12 @@ PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *self, PyObject * ar
 		return Py_None;
 	}
 
+	if (raw)
+	{
+		FIntPoint size = viewport->GetSizeXY();
+		return ue_py_screenshot_to_raw(bitmap, size.X, size.Y, py_buffer);
+	}
+
 	if (as_int_list)
 	{
 		PyObject *bitmap_tuple = PyTuple_New(bitmap.Num() * 4);
@@ -870,7 +1085,7 @@ PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *self, PyObject * ar
 	return bitmap_tuple;
 }
 
-PyObject *py_unreal_engine_get_viewport_size(PyObject *self, PyObject * args)
+PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *self, PyObject * args, PyObject *kwargs)
 {
 
 	if (!GEngine->GameViewport)
@@ -879,82 +1094,220 @@ PyObject *py_unreal_engine_get_viewport_size(PyObject *self, PyObject * args)
 		return Py_None;
 	}
 
-	FViewport *viewport = GEngine->GameViewport->Viewport;
-	PyObject *tuple_size = PyTuple_New(2);
-	FIntPoint point = viewport->GetSizeXY();
-
-	PyTuple_SetItem(tuple_size, 0, PyLong_FromLong(point.X));
-	PyTuple_SetItem(tuple_size, 1, PyLong_FromLong(point.Y));
-
-	return tuple_size;
+	return ue_py_get_viewport_screenshot(GEngine->GameViewport->Viewport, args, kwargs, "|OOO:get_viewport_screenshot");
 }
 
-#if WITH_EDITOR
-PyObject *py_unreal_engine_editor_get_active_viewport_screenshot(PyObject *self, PyObject * args)
+struct FPyScreenshotRequest
 {
+	PyObject *py_buffer;
+	PyObject *py_future;
+	PyObject *py_callable;
+	// FPlatformTime::Seconds() after which the request fails
+	double Deadline;
+};
 
-	FViewport *viewport = GEditor->GetActiveViewport();
-	if (!viewport)
+// requests completed by the next screenshot captured by the game viewport client
+class FPythonScreenshotRequests
+{
+public:
+	void Add(const FPyScreenshotRequest &Request, UGameViewportClient *Client)
 	{
-		Py_INCREF(Py_None);
-		return Py_None;
+		if (Requests.Num() == 0)
+		{
+			// screenshots are not saved to files while the delegate is bound, so do it only when required
+			CapturedHandle = UGameViewportClient::OnScreenshotCaptured().AddRaw(this, &FPythonScreenshotRequests::OnScreenshotCaptured);
+			// the viewport could be destroyed (or stop drawing) before capturing
+			TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPythonScreenshotRequests::Tick));
+			FScreenshotRequest::RequestScreenshot(false);
+		}
+		ViewportClient = Client;
+		Requests.Add(Request);
 	}
 
-	PyObject *py_bool = nullptr;
-	bool as_int_list = false;
-	if (!PyArg_ParseTuple(args, "|O:editor_get_active_viewport_screenshot", &py_bool))
+	void OnScreenshotCaptured(int32 Width, int32 Height, const TArray<FColor> &Colors)
 	{
-		return NULL;
+		Complete(&Colors, Width, Height, nullptr);
 	}
 
-	if (py_bool && PyObject_IsTrue(py_bool))
-		as_int_list = true;
+	bool Tick(float DeltaTime)
+	{
+		if (Requests.Num() == 0)
+		{
+			TickerHandle.Reset();
+			return false;
+		}
 
-	TArray<FColor> bitmap;
+		if (!ViewportClient.IsValid() || !ViewportClient->Viewport)
+		{
+			// removed by returning false
+			TickerHandle.Reset();
+			Complete(nullptr, 0, 0, "the game viewport has been destroyed");
+			return false;
+		}
 
-	bool success = GetViewportScreenShot(viewport, bitmap);
+		double Now = FPlatformTime::Seconds();
+		bool bExpired = false;
+		for (FPyScreenshotRequest &Request : Requests)
+		{
+			if (Now >= Request.Deadline)
+				bExpired = true;
+		}
 
-	if (!success)
-	{
-		Py_INCREF(Py_None);
-		return Py_None;
+		// a single capture serves all the pending requests, so they time out together
+		if (bExpired)
+		{
+			TickerHandle.Reset();
+			Complete(nullptr, 0, 0, "screenshot timed out, the game viewport has not been drawn");
+			return false;
+		}
+
+		return true;
 	}
 
-	if (as_int_list)
+	// Colors is null when failing, the callables are called with None
+	void Complete(const TArray<FColor> *Colors, int32 Width, int32 Height, const char *Error)
 	{
-		PyObject *bitmap_tuple = PyTuple_New(bitmap.Num() * 4);
-		for (int i = 0; i < bitmap.Num(); i++)
+		UGameViewportClient::OnScreenshotCaptured().Remove(CapturedHandle);
+		CapturedHandle.Reset();
+		if (TickerHandle.IsValid())
 		{
-			PyTuple_SetItem(bitmap_tuple, i * 4, PyLong_FromLong(bitmap[i].R));
-			PyTuple_SetItem(bitmap_tuple, i * 4 + 1, PyLong_FromLong(bitmap[i].G));
-			PyTuple_SetItem(bitmap_tuple, i * 4 + 2, PyLong_FromLong(bitmap[i].B));
-			PyTuple_SetItem(bitmap_tuple, i * 4 + 3, PyLong_FromLong(bitmap[i].A));
+			FTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+			TickerHandle.Reset();
+		}
+		// do not save a file if the viewport draws later
+		if (!Colors)
+			FScreenshotRequest::Reset();
+
+		FScopePythonGIL gil;
+
+		TArray<FPyScreenshotRequest> Completed = MoveTemp(Requests);
+		Requests.Empty();
+		for (FPyScreenshotRequest &Request : Completed)
+		{
+			PyObject *py_result = nullptr;
+			if (Colors)
+			{
+				py_result = ue_py_screenshot_to_raw(*Colors, Width, Height, Request.py_buffer);
+				if (!py_result)
+				{
+					unreal_engine_py_log_error();
+					Error = "unable to copy the screenshot";
+				}
+			}
+
+			if (Request.py_callable)
+			{
+				PyObject *ret = PyObject_CallFunctionObjArgs(Request.py_callable, py_result ? py_result : Py_None, nullptr);
+				if (!ret)
+					unreal_engine_py_log_error();
+				Py_XDECREF(ret);
+				Py_DECREF(Request.py_callable);
+			}
+
+#if PY_MAJOR_VERSION >= 3
+			if (Request.py_future)
+			{
+				if (py_result)
+					py_ue_async_resolve(Request.py_future, py_result);
+				else
+					py_ue_async_reject(Request.py_future, Error);
+				Py_DECREF(Request.py_future);
+			}
+#endif
+
+			Py_XDECREF(py_result);
+			Py_XDECREF(Request.py_buffer);
 		}
-		return bitmap_tuple;
 	}
 
-	PyObject *bitmap_tuple = PyTuple_New(bitmap.Num());
-	for (int i = 0; i < bitmap.Num(); i++)
+	TArray<FPyScreenshotRequest> Requests;
+	TWeakObjectPtr<UGameViewportClient> ViewportClient;
+	FDelegateHandle CapturedHandle;
+	FDelegateHandle TickerHandle;
+};
+
+static FPythonScreenshotRequests PythonScreenshotRequests;
+
+PyObject *py_unreal_engine_get_viewport_screenshot_async(PyObject *self, PyObject * args)
+{
+	PyObject *py_buffer = nullptr;
+	PyObject *py_callable = nullptr;
+	float timeout = 10;
+	if (!PyArg_ParseTuple(args, "|OOf:get_viewport_screenshot_async", &py_buffer, &py_callable, &timeout))
 	{
-		PyTuple_SetItem(bitmap_tuple, i, py_ue_new_fcolor(bitmap[i]));
+		return nullptr;
 	}
 
-	return bitmap_tuple;
+	if (!GEngine->GameViewport || !GEngine->GameViewport->Viewport)
+		return PyErr_Format(PyExc_Exception, "unable to get GameViewport");
+
+	if (py_buffer == Py_None)
+		py_buffer = nullptr;
+
+	if (py_callable == Py_None)
+		py_callable = nullptr;
+
+	if (py_callable && !PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_Exception, "argument is not callable");
+
+#if PY_MAJOR_VERSION < 3
+	if (!py_callable)
+		return PyErr_Format(PyExc_Exception, "a callable is required");
+#endif
+
+	if (py_buffer)
+	{
+		// fail early, the size could still change before the capture
+		FIntPoint size = GEngine->GameViewport->Viewport->GetSizeXY();
+		Py_ssize_t data_len = (Py_ssize_t)size.X * size.Y * sizeof(FColor);
+		Py_buffer py_buf;
+		if (PyObject_GetBuffer(py_buffer, &py_buf, PyBUF_WRITABLE) < 0)
+			return nullptr;
+		Py_ssize_t buf_len = py_buf.len;
+		PyBuffer_Release(&py_buf);
+		if (buf_len < data_len)
+			return PyErr_Format(PyExc_Exception, "buffer is not big enough (%d bytes required)", (int)data_len);
+	}
+
+	FPyScreenshotRequest Request;
+	Request.py_buffer = py_buffer;
+	Request.py_callable = py_callable;
+	Request.py_future = nullptr;
+	Request.Deadline = FPlatformTime::Seconds() + timeout;
+
+#if PY_MAJOR_VERSION >= 3
+	if (!py_callable)
+	{
+		Request.py_future = py_ue_async_new_future();
+		if (!Request.py_future)
+			return nullptr;
+	}
+#endif
+
+	Py_XINCREF(Request.py_buffer);
+	Py_XINCREF(Request.py_callable);
+	PythonScreenshotRequests.Add(Request, GEngine->GameViewport);
+
+	if (Request.py_future)
+	{
+		Py_INCREF(Request.py_future);
+		return Request.py_future;
+	}
+
+	Py_RETURN_NONE;
 }
 
-PyObject *py_unreal_engine_editor_get_active_viewport_size(PyObject *self, PyObject * args)
+PyObject *py_unreal_engine_get_viewport_size(PyObject *self, PyObject * args)
 {
 
-
-	FViewport *viewport = GEditor->GetActiveViewport();
-	if (!viewport)
+	if (!GEngine->GameViewport)
 	{
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
+	FViewport *viewport = GEngine->GameViewport->Viewport;
 	PyObject *tuple_size = PyTuple_New(2);
-
 	FIntPoint point = viewport->GetSizeXY();
 
 	PyTuple_SetItem(tuple_size, 0, PyLong_FromLong(point.X));
@@ -963,56 +1316,52 @@ PyObject *py_unreal_engine_editor_get_active_viewport_size(PyObject *self, PyObj
 	return tuple_size;
 }
 
-PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot(PyObject *self, PyObject * args)
+#if WITH_EDITOR
+PyObject *py_unreal_engine_editor_get_active_viewport_screenshot(PyObject *self, PyObject * args, PyObject *kwargs)
 {
 
-	FViewport *viewport = GEditor->GetPIEViewport();
+	FViewport *viewport = GEditor->GetActiveViewport();
 	if (!viewport)
 	{
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
-	PyObject *py_bool = nullptr;
-	bool as_int_list = false;
-	if (!PyArg_ParseTuple(args, "|O:editor_get_pie_viewport_screenshot", &py_bool))
-	{
-		return NULL;
-	}
-
-	if (py_bool && PyObject_IsTrue(py_bool))
-		as_int_list = true;
+	return ue_py_get_viewport_screenshot(viewport, args, kwargs, "|OOO:editor_get_active_viewport_screenshot");
+}
 
-	TArray<FColor> bitmap;
+PyObject *py_unreal_engine_editor_get_active_viewport_size(PyObject *self, PyObject * args)
+{
 
-	bool success = GetViewportScreenShot(viewport, bitmap);
 
-	if (!success)
+	FViewport *viewport = GEditor->GetActiveViewport();
+	if (!viewport)
 	{
 		Py_INCREF(Py_None);
 		return Py_None;
 	}
 
-	if (as_int_list)
-	{
-		PyObject *bitmap_tuple = PyTuple_New(bitmap.Num() * 4);
-		for (int i = 0; i < bitmap.Num(); i++)
-		{
-			PyTuple_SetItem(bitmap_tuple, i * 4, PyLong_FromLong(bitmap[i].R));
-			PyTuple_SetItem(bitmap_tuple, i * 4 + 1, PyLong_FromLong(bitmap[i].G));
-			PyTuple_SetItem(bitmap_tuple, i * 4 + 2, PyLong_FromLong(bitmap[i].B));
-			PyTuple_SetItem(bitmap_tuple, i * 4 + 3, PyLong_FromLong(bitmap[i].A));
-		}
-		return bitmap_tuple;
-	}
+	PyObject *tuple_size = PyTuple_New(2);
 
-	PyObject *bitmap_tuple = PyTuple_New(bitmap.Num());
-	for (int i = 0; i < bitmap.Num(); i++)
+	FIntPoint point = viewport->GetSizeXY();
+
+	PyTuple_SetItem(tuple_size, 0, PyLong_FromLong(point.X));
+	PyTuple_SetItem(tuple_size, 1, PyLong_FromLong(point.Y));
+
+	return tuple_size;
+}
+
+PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot(PyObject *self, PyObject * args, PyObject *kwargs)
+{
+
+	FViewport *viewport = GEditor->GetPIEViewport();
+	if (!viewport)
 	{
-		PyTuple_SetItem(bitmap_tuple, i, py_ue_new_fcolor(bitmap[i]));
+		Py_INCREF(Py_None);
+		return Py_None;
 	}
 
-	return bitmap_tuple;
+	return ue_py_get_viewport_screenshot(viewport, args, kwargs, "|OOO:editor_get_pie_viewport_screenshot");
 }
 
 PyObject *py_unreal_engine_editor_get_pie_viewport_size(PyObject *self, PyObject * args)
@@ -1056,7 +1405,9 @@ PyObject *py_unreal_engine_create_package(PyObject *self, PyObject * args)
 		return PyErr_Format(PyExc_Exception, "unable to create package");
 	u_package->FileName = *FPackageName::LongPackageNameToFilename(UTF8_TO_TCHAR(name), FPackageName::GetAssetPackageExtension());
 
+	Py_BEGIN_ALLOW_THREADS;
 	u_package->FullyLoad();
+	Py_END_ALLOW_THREADS;
 	u_package->MarkPackageDirty();
 
 	Py_RETURN_UOBJECT(u_package);
@@ -1081,7 +1432,9 @@ PyObject *py_unreal_engine_get_or_create_package(PyObject *self, PyObject * args
 			return PyErr_Format(PyExc_Exception, "unable to create package");
 		u_package->FileName = *FPackageName::LongPackageNameToFilename(UTF8_TO_TCHAR(name), FPackageName::GetAssetPackageExtension());
 
+		Py_BEGIN_ALLOW_THREADS;
 		u_package->FullyLoad();
+		Py_END_ALLOW_THREADS;
 		u_package->MarkPackageDirty();
 	}
 
@@ -47,12 +47,19 @@ PyObject *py_unreal_engine_guid_to_string(PyObject *, PyObject *);
 PyObject *py_unreal_engine_engine_tick(PyObject *, PyObject *);
 PyObject *py_unreal_engine_slate_tick(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_delta_time(PyObject *, PyObject *);
+PyObject *py_unreal_engine_flush_coalesced_events(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_tick_rendering_tickables(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_all_classes(PyObject *, PyObject *);
 PyObject *py_unreal_engine_all_worlds(PyObject *, PyObject *);
 PyObject *py_unreal_engine_tobject_iterator(PyObject *, PyObject *);
+PyObject *py_unreal_engine_iter_objects(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_iter_classes(PyObject *, PyObject *);
+
+PyObject *py_unreal_engine_set_python_tick_lod(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_python_tick_schedule(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_python_tick_stats(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_all_worlds(PyObject *, PyObject *);
 PyObject *py_unreal_engine_tobject_iterator(PyObject *, PyObject *);
@@ -65,10 +72,12 @@ PyObject *py_unreal_engine_get_mutable_default(PyObject *, PyObject *);
 
 
 PyObject *py_unreal_engine_create_and_dispatch_when_ready(PyObject *, PyObject *);
+PyObject *py_unreal_engine_when_all(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_convert_relative_path_to_full(PyObject *, PyObject *);
 
-PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_viewport_screenshot(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_viewport_screenshot_async(PyObject *, PyObject *);
 PyObject *py_unreal_engine_get_viewport_size(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_create_world(PyObject *, PyObject *);
@@ -88,8 +97,8 @@ PyObject *py_unreal_engine_save_file_dialog(PyObject *, PyObject *);
 PyObject *py_unreal_engine_copy_properties_for_unrelated_objects(PyObject *, PyObject *, PyObject *);
 
 #if WITH_EDITOR
-PyObject *py_unreal_engine_editor_get_active_viewport_screenshot(PyObject *, PyObject *);
-PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot(PyObject *, PyObject *);
+PyObject *py_unreal_engine_editor_get_active_viewport_screenshot(PyObject *, PyObject *, PyObject *);
+PyObject *py_unreal_engine_editor_get_pie_viewport_screenshot(PyObject *, PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_editor_get_active_viewport_size(PyObject *, PyObject *);
 PyObject *py_unreal_engine_editor_get_pie_viewport_size(PyObject *, PyObject *);
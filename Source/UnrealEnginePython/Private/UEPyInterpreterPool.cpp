@@ -0,0 +1,1019 @@
+#include "UEPyInterpreterPool.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+#include "Wrappers/UEPyFGraphTask.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "HAL/ThreadSafeCounter.h"
+
+// per-interpreter GIL (PEP 684)
+#if PY_VERSION_HEX >= 0x030C0000
+#define UEPY_OWN_GIL_INTERPRETERS 1
+#else
+#define UEPY_OWN_GIL_INTERPRETERS 0
+#endif
+
+// python objects cannot cross interpreters, job arguments and results are converted to this
+struct FPythonPoolValue
+{
+	enum EType
+	{
+		None,
+		Bool,
+		Int,
+		Float,
+		String,
+		Bytes,
+		// index in the buffers of the job, exposed as a memoryview
+		Buffer,
+		List,
+		Tuple,
+	};
+
+	EType Type;
+	int64 Int;
+	double Float;
+	// utf8 for strings
+	TArray<uint8> Data;
+	TArray<FPythonPoolValue> Items;
+
+	FPythonPoolValue() : Type(None), Int(0), Float(0)
+	{
+	}
+};
+
+struct FPythonPoolJob
+{
+	FString Module;
+	FString Function;
+	TArray<FPythonPoolValue> Args;
+	// acquired from the main interpreter objects, released (with its GIL) when the job is completed
+	TArray<Py_buffer> Buffers;
+	// objects of the worker interpreter still exported the buffers when the pool stopped, they are never released
+	bool bBuffersInUse;
+
+	bool bFailed;
+	// the job failed because its buffers were still exported
+	bool bBufferError;
+	FString Error;
+	FPythonPoolValue Result;
+
+	FPyGraphTaskStatePtr State;
+	// completes the event of the task handle
+	TGraphTask<FNullGraphTask> *Gate;
+
+	FPythonPoolJob() : bBuffersInUse(false), bFailed(false), bBufferError(false), Gate(nullptr)
+	{
+	}
+};
+
+// the GIL of the interpreter owning the object must be held
+// Buffers is null when converting results: objects supporting the buffer protocol are copied to bytes
+static bool ue_py_pool_value_from_pyobject(PyObject *py_obj, FPythonPoolValue &Value, TArray<Py_buffer> *Buffers)
+{
+	if (py_obj == Py_None)
+	{
+		Value.Type = FPythonPoolValue::None;
+		return true;
+	}
+
+	if (PyBool_Check(py_obj))
+	{
+		Value.Type = FPythonPoolValue::Bool;
+		Value.Int = py_obj == Py_True ? 1 : 0;
+		return true;
+	}
+
+	if (PyLong_Check(py_obj))
+	{
+		Value.Type = FPythonPoolValue::Int;
+		Value.Int = PyLong_AsLongLong(py_obj);
+		return !(Value.Int == -1 && PyErr_Occurred());
+	}
+
+	if (PyFloat_Check(py_obj))
+	{
+		Value.Type = FPythonPoolValue::Float;
+		Value.Float = PyFloat_AsDouble(py_obj);
+		return true;
+	}
+
+	if (PyUnicode_Check(py_obj))
+	{
+		Py_ssize_t len;
+		const char *utf8 = PyUnicode_AsUTF8AndSize(py_obj, &len);
+		if (!utf8)
+			return false;
+		Value.Type = FPythonPoolValue::String;
+		Value.Data.Append((const uint8 *)utf8, len);
+		return true;
+	}
+
+	if (PyBytes_Check(py_obj))
+	{
+		Value.Type = FPythonPoolValue::Bytes;
+		Value.Data.Append((const uint8 *)PyBytes_AsString(py_obj), PyBytes_Size(py_obj));
+		return true;
+	}
+
+	if (PyList_Check(py_obj) || PyTuple_Check(py_obj))
+	{
+		Value.Type = PyList_Check(py_obj) ? FPythonPoolValue::List : FPythonPoolValue::Tuple;
+		Py_ssize_t len = PySequence_Size(py_obj);
+		for (Py_ssize_t i = 0; i < len; i++)
+		{
+			PyObject *py_item = PySequence_GetItem(py_obj, i);
+			if (!py_item)
+				return false;
+			int32 Item = Value.Items.AddDefaulted();
+			bool bConverted = ue_py_pool_value_from_pyobject(py_item, Value.Items[Item], Buffers);
+			Py_DECREF(py_item);
+			if (!bConverted)
+				return false;
+		}
+		return true;
+	}
+
+	if (PyObject_CheckBuffer(py_obj))
+	{
+		Py_buffer buffer;
+		if (PyObject_GetBuffer(py_obj, &buffer, Buffers ? PyBUF_WRITABLE : PyBUF_SIMPLE) < 0)
+		{
+			if (!Buffers)
+				return false;
+			// read-only memoryview
+			PyErr_Clear();
+			if (PyObject_GetBuffer(py_obj, &buffer, PyBUF_SIMPLE) < 0)
+				return false;
+		}
+
+		if (Buffers)
+		{
+			Value.Type = FPythonPoolValue::Buffer;
+			Value.Int = Buffers->Add(buffer);
+			return true;
+		}
+
+		Value.Type = FPythonPoolValue::Bytes;
+		Value.Data.Append((const uint8 *)buffer.buf, buffer.len);
+		PyBuffer_Release(&buffer);
+		return true;
+	}
+
+	PyErr_Format(PyExc_TypeError, "unable to pass a %s object between interpreters", Py_TYPE(py_obj)->tp_name);
+	return false;
+}
+
+// exports a buffer of a job to the worker interpreter without copying it, counting the buffers
+// (the memoryview of the job and the slices/casts derived from it) still using the memory
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		void *data;
+	Py_ssize_t size;
+	bool readonly;
+	int32 exports;
+} ue_PyPoolBuffer;
+
+static int ue_py_pool_buffer_getbuffer(ue_PyPoolBuffer *self, Py_buffer *view, int flags)
+{
+	if (!self->data)
+	{
+		view->obj = nullptr;
+		PyErr_SetString(PyExc_BufferError, "the job has already been completed");
+		return -1;
+	}
+
+	if (PyBuffer_FillInfo(view, (PyObject *)self, self->data, self->size, self->readonly ? 1 : 0, flags) < 0)
+		return -1;
+
+	self->exports++;
+	return 0;
+}
+
+static void ue_py_pool_buffer_releasebuffer(ue_PyPoolBuffer *self, Py_buffer *view)
+{
+	self->exports--;
+}
+
+static void ue_py_pool_buffer_dealloc(ue_PyPoolBuffer *self)
+{
+	PyTypeObject *type = Py_TYPE(self);
+	type->tp_free((PyObject *)self);
+	Py_DECREF(type);
+}
+
+static PyType_Slot ue_PyPoolBuffer_slots[] = {
+	{ Py_tp_dealloc, (void *)ue_py_pool_buffer_dealloc },
+	{ 0, nullptr },
+};
+
+static PyType_Spec ue_PyPoolBuffer_spec = {
+	"unreal_engine.PoolBuffer",
+	sizeof(ue_PyPoolBuffer),
+	0,
+	Py_TPFLAGS_DEFAULT,
+	ue_PyPoolBuffer_slots,
+};
+
+// the GIL of the interpreter owning the exporters must be held
+static bool ue_py_pool_buffers_exported(const TArray<PyObject *> &Exporters)
+{
+	for (PyObject *py_exporter : Exporters)
+	{
+		if (((ue_PyPoolBuffer *)py_exporter)->exports > 0)
+			return true;
+	}
+	return false;
+}
+
+// static types cannot be shared by interpreters with their own GIL, every worker creates its own heap type
+static PyTypeObject *ue_py_pool_new_buffer_type()
+{
+	PyTypeObject *type = (PyTypeObject *)PyType_FromSpec(&ue_PyPoolBuffer_spec);
+	if (!type)
+		return nullptr;
+	// buffer slots are not accepted by PyType_FromSpec before python 3.9
+	PyHeapTypeObject *heap_type = (PyHeapTypeObject *)type;
+	heap_type->as_buffer.bf_getbuffer = (getbufferproc)ue_py_pool_buffer_getbuffer;
+	heap_type->as_buffer.bf_releasebuffer = (releasebufferproc)ue_py_pool_buffer_releasebuffer;
+	type->tp_as_buffer = &heap_type->as_buffer;
+	return type;
+}
+
+// Buffers are exported (without copies) by new objects of BufferType, added to Exporters
+static PyObject *ue_py_pool_value_to_pyobject(const FPythonPoolValue &Value, TArray<Py_buffer> *Buffers, PyTypeObject *BufferType, TArray<PyObject *> *Exporters)
+{
+	switch (Value.Type)
+	{
+	case FPythonPoolValue::Bool:
+		return PyBool_FromLong((long)Value.Int);
+	case FPythonPoolValue::Int:
+		return PyLong_FromLongLong(Value.Int);
+	case FPythonPoolValue::Float:
+		return PyFloat_FromDouble(Value.Float);
+	case FPythonPoolValue::String:
+		return PyUnicode_FromStringAndSize((const char *)Value.Data.GetData(), Value.Data.Num());
+	case FPythonPoolValue::Bytes:
+		return PyBytes_FromStringAndSize((const char *)Value.Data.GetData(), Value.Data.Num());
+	case FPythonPoolValue::Buffer:
+	{
+		Py_buffer &buffer = (*Buffers)[Value.Int];
+		// increments the reference count of the heap type on every python version
+		ue_PyPoolBuffer *py_exporter = (ue_PyPoolBuffer *)PyType_GenericAlloc(BufferType, 0);
+		if (!py_exporter)
+			return nullptr;
+		py_exporter->data = buffer.buf;
+		py_exporter->size = buffer.len;
+		py_exporter->readonly = buffer.readonly != 0;
+		py_exporter->exports = 0;
+		Exporters->Add((PyObject *)py_exporter);
+		return PyMemoryView_FromObject((PyObject *)py_exporter);
+	}
+	case FPythonPoolValue::List:
+	case FPythonPoolValue::Tuple:
+	{
+		bool bList = Value.Type == FPythonPoolValue::List;
+		PyObject *py_items = bList ? PyList_New(Value.Items.Num()) : PyTuple_New(Value.Items.Num());
+		for (int32 i = 0; i < Value.Items.Num(); i++)
+		{
+			PyObject *py_item = ue_py_pool_value_to_pyobject(Value.Items[i], Buffers, BufferType, Exporters);
+			if (!py_item)
+			{
+				Py_DECREF(py_items);
+				return nullptr;
+			}
+			if (bList)
+				PyList_SET_ITEM(py_items, i, py_item);
+			else
+				PyTuple_SET_ITEM(py_items, i, py_item);
+		}
+		return py_items;
+	}
+	default:
+		break;
+	}
+	Py_RETURN_NONE;
+}
+
+// formats (and clears) the current exception of the interpreter
+static FString ue_py_pool_fetch_error()
+{
+	PyObject *type = nullptr, *value = nullptr, *traceback = nullptr;
+	PyErr_Fetch(&type, &value, &traceback);
+	PyErr_NormalizeException(&type, &value, &traceback);
+
+	FString Error = TEXT("unknown error");
+	PyObject *py_traceback_module = PyImport_ImportModule("traceback");
+	if (py_traceback_module)
+	{
+		PyObject *py_lines = PyObject_CallMethod(py_traceback_module, (char *)"format_exception", (char *)"OOO", type, value ? value : Py_None, traceback ? traceback : Py_None);
+		if (py_lines)
+		{
+			PyObject *py_empty = PyUnicode_FromString("");
+			PyObject *py_text = PyUnicode_Join(py_empty, py_lines);
+			if (py_text)
+			{
+				Error = UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_text));
+				Py_DECREF(py_text);
+			}
+			Py_DECREF(py_empty);
+			Py_DECREF(py_lines);
+		}
+		Py_DECREF(py_traceback_module);
+	}
+	PyErr_Clear();
+
+	Py_XDECREF(type);
+	Py_XDECREF(value);
+	Py_XDECREF(traceback);
+	return Error;
+}
+
+// the unreal_engine module of the sub-interpreters: the main one is bound to the main interpreter (static types, GIL state api)
+static PyObject *ue_py_pool_log_message(PyObject *args, ELogVerbosity::Type Verbosity)
+{
+	PyObject *py_message;
+	if (!PyArg_ParseTuple(args, "O:log", &py_message))
+	{
+		return nullptr;
+	}
+
+	PyObject *py_str = PyObject_Str(py_message);
+	if (!py_str)
+		return nullptr;
+
+	FString Message = UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_str));
+	Py_DECREF(py_str);
+
+	switch (Verbosity)
+	{
+	case ELogVerbosity::Error:
+		UE_LOG(LogPython, Error, TEXT("%s"), *Message);
+		break;
+	case ELogVerbosity::Warning:
+		UE_LOG(LogPython, Warning, TEXT("%s"), *Message);
+		break;
+	default:
+		UE_LOG(LogPython, Log, TEXT("%s"), *Message);
+		break;
+	}
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_pool_log(PyObject *self, PyObject * args)
+{
+	return ue_py_pool_log_message(args, ELogVerbosity::Log);
+}
+
+static PyObject *py_ue_pool_log_warning(PyObject *self, PyObject * args)
+{
+	return ue_py_pool_log_message(args, ELogVerbosity::Warning);
+}
+
+static PyObject *py_ue_pool_log_error(PyObject *self, PyObject * args)
+{
+	return ue_py_pool_log_message(args, ELogVerbosity::Error);
+}
+
+static PyMethodDef ue_py_pool_module_methods[] = {
+	{ "log", py_ue_pool_log, METH_VARARGS, "" },
+	{ "log_warning", py_ue_pool_log_warning, METH_VARARGS, "" },
+	{ "log_error", py_ue_pool_log_error, METH_VARARGS, "" },
+	{ NULL, NULL },
+};
+
+static PyModuleDef ue_py_pool_module = {
+	PyModuleDef_HEAD_INIT,
+	"unreal_engine",
+	"Unreal Engine Python module (interpreter pool worker).",
+	-1,
+	ue_py_pool_module_methods,
+};
+
+class FPythonInterpreterPool;
+
+// a job whose buffers were still exported by objects of the worker interpreter when it ended
+struct FPythonPoolExportedJob
+{
+	FPythonPoolJob *Job;
+	TArray<PyObject *> Exporters;
+};
+
+class FPythonInterpreterWorker : public FRunnable
+{
+public:
+	FPythonInterpreterWorker(FPythonInterpreterPool *InPool, int32 InIndex);
+	~FPythonInterpreterWorker();
+
+	virtual uint32 Run() override;
+
+	FEvent *WakeEvent;
+	FRunnableThread *Thread;
+
+private:
+	void RunJobs(bool bSubInterpreter);
+	void SetupSubInterpreter();
+	// returns false if the buffers of the job are still exported, the job is added to ExportedJobs
+	bool Execute(FPythonPoolJob *Job);
+	// returns the jobs whose buffers are not exported anymore
+	TArray<FPythonPoolJob *> CollectExportedJobs(bool bStopping);
+
+	FPythonInterpreterPool *Pool;
+	int32 Index;
+	// owned by the interpreter running the jobs
+	PyTypeObject *BufferType;
+	TArray<FPythonPoolExportedJob> ExportedJobs;
+};
+
+class FPythonInterpreterPool
+{
+public:
+	FPythonInterpreterPool() : bOwnGIL(false), bStopping(false)
+	{
+	}
+
+	bool IsRunning() const
+	{
+		return Workers.Num() > 0;
+	}
+
+	void Start(int32 NumWorkers, bool bInOwnGIL)
+	{
+		bOwnGIL = bInOwnGIL;
+		bStopping = false;
+		for (int32 i = 0; i < NumWorkers; i++)
+		{
+			FPythonInterpreterWorker *Worker = new FPythonInterpreterWorker(this, i);
+			Workers.Add(Worker);
+			Worker->Thread = FRunnableThread::Create(Worker, *FString::Printf(TEXT("PythonInterpreterPool%d"), i));
+		}
+	}
+
+	void Stop()
+	{
+		if (!IsRunning())
+			return;
+
+		{
+			FScopeLock Lock(&QueueLock);
+			bStopping = true;
+		}
+
+		for (FPythonInterpreterWorker *Worker : Workers)
+		{
+			Worker->WakeEvent->Trigger();
+		}
+
+		for (FPythonInterpreterWorker *Worker : Workers)
+		{
+			Worker->Thread->WaitForCompletion();
+			delete Worker->Thread;
+			delete Worker;
+		}
+		Workers.Empty();
+
+		TArray<FPythonPoolJob *> Pending;
+		{
+			FScopeLock Lock(&QueueLock);
+			Pending = MoveTemp(Queue);
+			Queue.Empty();
+		}
+
+		for (FPythonPoolJob *Job : Pending)
+		{
+			Job->bFailed = true;
+			Job->Error = TEXT("interpreter pool stopped");
+			CompleteJob(Job);
+		}
+
+		// completions need the GIL of the main interpreter
+		while (Completions.GetValue() > 0)
+		{
+			FPlatformProcess::Sleep(0.001f);
+		}
+	}
+
+	void Submit(FPythonPoolJob *Job)
+	{
+		Submitted.Increment();
+		{
+			FScopeLock Lock(&QueueLock);
+			if (!bStopping)
+			{
+				Queue.Add(Job);
+				Job = nullptr;
+			}
+		}
+
+		if (Job)
+		{
+			Job->bFailed = true;
+			Job->Error = TEXT("interpreter pool stopped");
+			CompleteJob(Job);
+			return;
+		}
+
+		for (FPythonInterpreterWorker *Worker : Workers)
+		{
+			Worker->WakeEvent->Trigger();
+		}
+	}
+
+	// returns null when the pool is stopping (or, if bPoll, when no job has been queued after a short wait)
+	FPythonPoolJob *WaitForJob(FEvent *WakeEvent, bool bPoll)
+	{
+		for (;;)
+		{
+			{
+				FScopeLock Lock(&QueueLock);
+				if (bStopping)
+					return nullptr;
+				if (Queue.Num() > 0)
+				{
+					FPythonPoolJob *Job = Queue[0];
+					Queue.RemoveAt(0, 1, false);
+					return Job;
+				}
+			}
+			if (bPoll)
+			{
+				WakeEvent->Wait(10);
+				FScopeLock Lock(&QueueLock);
+				if (bStopping || Queue.Num() == 0)
+					return nullptr;
+				FPythonPoolJob *Job = Queue[0];
+				Queue.RemoveAt(0, 1, false);
+				return Job;
+			}
+			WakeEvent->Wait(100);
+		}
+	}
+
+	bool IsStopping()
+	{
+		FScopeLock Lock(&QueueLock);
+		return bStopping;
+	}
+
+	// called without holding any GIL, python objects of the main interpreter are touched in a TaskGraph thread
+	void CompleteJob(FPythonPoolJob *Job)
+	{
+		Completions.Increment();
+		FFunctionGraphTask::CreateAndDispatchWhenReady([this, Job]()
+		{
+			{
+				FScopePythonGIL gil;
+
+				PyObject *py_ret = nullptr;
+				if (Job->bFailed)
+				{
+					PyErr_SetString(Job->bBufferError ? PyExc_BufferError : PyExc_Exception, TCHAR_TO_UTF8(*Job->Error));
+				}
+				else
+				{
+					py_ret = ue_py_pool_value_to_pyobject(Job->Result, nullptr, nullptr, nullptr);
+				}
+				Job->State->Complete(py_ret);
+
+				if (Job->bBuffersInUse)
+				{
+					UE_LOG(LogPython, Warning, TEXT("interpreter pool job %s.%s still exports its buffers, they will never be released"), *Job->Module, *Job->Function);
+				}
+				else
+				{
+					for (Py_buffer &Buffer : Job->Buffers)
+					{
+						PyBuffer_Release(&Buffer);
+					}
+				}
+				Job->State.Reset();
+			}
+
+			Job->Gate->Unlock();
+			delete Job;
+			Completed.Increment();
+			Completions.Decrement();
+		}, TStatId(), nullptr, ENamedThreads::AnyThread);
+	}
+
+	bool bOwnGIL;
+#if UEPY_OWN_GIL_INTERPRETERS
+	PyInterpreterState *MainInterpreter;
+#endif
+	TArray<FString> SysPath;
+
+	TArray<FPythonInterpreterWorker *> Workers;
+
+	FCriticalSection QueueLock;
+	TArray<FPythonPoolJob *> Queue;
+	bool bStopping;
+
+	FThreadSafeCounter Completions;
+	FThreadSafeCounter Submitted;
+	FThreadSafeCounter Completed;
+};
+
+static FPythonInterpreterPool PythonInterpreterPool;
+
+FPythonInterpreterWorker::FPythonInterpreterWorker(FPythonInterpreterPool *InPool, int32 InIndex) : Thread(nullptr), Pool(InPool), Index(InIndex), BufferType(nullptr)
+{
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+}
+
+FPythonInterpreterWorker::~FPythonInterpreterWorker()
+{
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+}
+
+uint32 FPythonInterpreterWorker::Run()
+{
+#if UEPY_OWN_GIL_INTERPRETERS
+	if (Pool->bOwnGIL)
+	{
+		// a thread state of the main interpreter is required for creating the sub-interpreter
+		PyThreadState *MainThreadState = PyThreadState_New(Pool->MainInterpreter);
+		PyEval_RestoreThread(MainThreadState);
+
+		PyInterpreterConfig Config;
+		FMemory::Memzero(Config);
+		Config.use_main_obmalloc = 0;
+		Config.allow_fork = 0;
+		Config.allow_exec = 0;
+		Config.allow_threads = 1;
+		Config.allow_daemon_threads = 0;
+		Config.check_multi_interp_extensions = 1;
+		Config.gil = PyInterpreterConfig_OWN_GIL;
+
+		PyThreadState *ThreadState = nullptr;
+		PyStatus Status = Py_NewInterpreterFromConfig(&ThreadState, &Config);
+		if (!PyStatus_Exception(Status))
+		{
+			// the GIL of the main interpreter has been released, the one of the new interpreter is held
+			SetupSubInterpreter();
+			RunJobs(true);
+			Py_EndInterpreter(ThreadState);
+
+			PyEval_RestoreThread(MainThreadState);
+		}
+		else
+		{
+			UE_LOG(LogPython, Error, TEXT("unable to create python sub-interpreter: %s, jobs will run in the main interpreter"), UTF8_TO_TCHAR(Status.err_msg ? Status.err_msg : "unknown error"));
+		}
+
+		PyThreadState_Clear(MainThreadState);
+		PyThreadState_DeleteCurrent();
+
+		if (!PyStatus_Exception(Status))
+			return 0;
+	}
+#endif
+
+	RunJobs(false);
+	return 0;
+}
+
+void FPythonInterpreterWorker::SetupSubInterpreter()
+{
+	PyObject *py_path = PyList_New(0);
+	for (FString &Path : Pool->SysPath)
+	{
+		PyObject *py_item = PyUnicode_FromString(TCHAR_TO_UTF8(*Path));
+		PyList_Append(py_path, py_item);
+		Py_DECREF(py_item);
+	}
+	PySys_SetObject("path", py_path);
+	Py_DECREF(py_path);
+
+	// the module is found in sys.modules, so the (single-phase) builtin one is never imported
+	PyObject *py_module = PyModule_Create(&ue_py_pool_module);
+	if (!py_module)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+	PyModule_AddIntConstant(py_module, "POOL_WORKER", Index);
+	PyDict_SetItemString(PyImport_GetModuleDict(), "unreal_engine", py_module);
+	Py_DECREF(py_module);
+}
+
+void FPythonInterpreterWorker::RunJobs(bool bSubInterpreter)
+{
+	// the GIL of the sub-interpreter is held only while executing a job
+	PyThreadState *ThreadState = bSubInterpreter ? PyEval_SaveThread() : nullptr;
+
+	for (;;)
+	{
+		// while buffers are exported the worker wakes up periodically to check them
+		FPythonPoolJob *Job = Pool->WaitForJob(WakeEvent, ExportedJobs.Num() > 0);
+		if (!Job && Pool->IsStopping())
+			break;
+
+		bool bCompleted = true;
+		TArray<FPythonPoolJob *> Released;
+		if (bSubInterpreter)
+		{
+			PyEval_RestoreThread(ThreadState);
+			if (Job)
+				bCompleted = Execute(Job);
+			Released = CollectExportedJobs(false);
+			ThreadState = PyEval_SaveThread();
+		}
+		else
+		{
+			FScopePythonGIL gil;
+			if (Job)
+				bCompleted = Execute(Job);
+			Released = CollectExportedJobs(false);
+		}
+
+		if (Job && bCompleted)
+			Pool->CompleteJob(Job);
+		for (FPythonPoolJob *ReleasedJob : Released)
+		{
+			Pool->CompleteJob(ReleasedJob);
+		}
+	}
+
+	TArray<FPythonPoolJob *> Released;
+	if (bSubInterpreter)
+	{
+		PyEval_RestoreThread(ThreadState);
+		Released = CollectExportedJobs(true);
+		Py_CLEAR(BufferType);
+	}
+	else
+	{
+		FScopePythonGIL gil;
+		Released = CollectExportedJobs(true);
+		Py_CLEAR(BufferType);
+	}
+
+	// the jobs whose buffers are still exported are completed without releasing them (the memory stays valid)
+	for (FPythonPoolJob *ReleasedJob : Released)
+	{
+		Pool->CompleteJob(ReleasedJob);
+	}
+}
+
+TArray<FPythonPoolJob *> FPythonInterpreterWorker::CollectExportedJobs(bool bStopping)
+{
+	TArray<FPythonPoolJob *> Released;
+	for (int32 i = ExportedJobs.Num() - 1; i >= 0; i--)
+	{
+		FPythonPoolExportedJob &ExportedJob = ExportedJobs[i];
+		bool bExported = ue_py_pool_buffers_exported(ExportedJob.Exporters);
+
+		if (bExported && !bStopping)
+			continue;
+
+		for (PyObject *py_exporter : ExportedJob.Exporters)
+		{
+			if (!bExported)
+				((ue_PyPoolBuffer *)py_exporter)->data = nullptr;
+			Py_DECREF(py_exporter);
+		}
+		if (bExported)
+			ExportedJob.Job->bBuffersInUse = true;
+		Released.Add(ExportedJob.Job);
+		ExportedJobs.RemoveAt(i);
+	}
+	return Released;
+}
+
+bool FPythonInterpreterWorker::Execute(FPythonPoolJob *Job)
+{
+	if (!BufferType)
+	{
+		BufferType = ue_py_pool_new_buffer_type();
+		if (!BufferType)
+		{
+			Job->bFailed = true;
+			Job->Error = ue_py_pool_fetch_error();
+			return true;
+		}
+	}
+
+	TArray<PyObject *> Exporters;
+	PyObject *ret = nullptr;
+
+	PyObject *py_module = PyImport_ImportModule(TCHAR_TO_UTF8(*Job->Module));
+	if (py_module)
+	{
+		PyObject *py_function = PyObject_GetAttrString(py_module, TCHAR_TO_UTF8(*Job->Function));
+		Py_DECREF(py_module);
+		if (py_function)
+		{
+			PyObject *py_args = PyTuple_New(Job->Args.Num());
+			bool bArgsConverted = true;
+			for (int32 i = 0; i < Job->Args.Num(); i++)
+			{
+				PyObject *py_arg = ue_py_pool_value_to_pyobject(Job->Args[i], &Job->Buffers, BufferType, &Exporters);
+				if (!py_arg)
+				{
+					bArgsConverted = false;
+					break;
+				}
+				PyTuple_SET_ITEM(py_args, i, py_arg);
+			}
+
+			if (bArgsConverted)
+			{
+				ret = PyObject_CallObject(py_function, py_args);
+			}
+			Py_DECREF(py_args);
+			Py_DECREF(py_function);
+		}
+	}
+
+	if (ret)
+	{
+		if (!ue_py_pool_value_from_pyobject(ret, Job->Result, nullptr))
+		{
+			Job->Result = FPythonPoolValue();
+		}
+		Py_DECREF(ret);
+	}
+
+	if (PyErr_Occurred())
+	{
+		Job->bFailed = true;
+		Job->Error = ue_py_pool_fetch_error();
+	}
+
+	// the memory is owned by objects of the main interpreter: the job is completed (and the buffers released)
+	// only when no object of this interpreter (memoryviews, slices, numpy arrays...) is using it anymore
+	bool bExported = ue_py_pool_buffers_exported(Exporters);
+	if (bExported)
+	{
+		// views kept alive only by reference cycles are freed by a collection
+		PyGC_Collect();
+		bExported = ue_py_pool_buffers_exported(Exporters);
+	}
+
+	if (!bExported)
+	{
+		for (PyObject *py_exporter : Exporters)
+		{
+			((ue_PyPoolBuffer *)py_exporter)->data = nullptr;
+			Py_DECREF(py_exporter);
+		}
+		return true;
+	}
+
+	if (!Job->bFailed)
+	{
+		Job->bFailed = true;
+		Job->bBufferError = true;
+		Job->Error = FString::Printf(TEXT("the buffers of %s.%s were still exported when the job ended"), *Job->Module, *Job->Function);
+	}
+	FPythonPoolExportedJob ExportedJob;
+	ExportedJob.Job = Job;
+	ExportedJob.Exporters = MoveTemp(Exporters);
+	ExportedJobs.Add(ExportedJob);
+	return false;
+}
+
+PyObject *py_unreal_engine_interpreter_pool_start(PyObject * self, PyObject * args)
+{
+	int workers = FPlatformMisc::NumberOfCores() - 1;
+	PyObject *py_own_gil = nullptr;
+	if (!PyArg_ParseTuple(args, "|iO:interpreter_pool_start", &workers, &py_own_gil))
+	{
+		return nullptr;
+	}
+
+	if (PythonInterpreterPool.IsRunning())
+		return PyErr_Format(PyExc_Exception, "interpreter pool is already running");
+
+	if (workers < 1)
+		return PyErr_Format(PyExc_ValueError, "at least one worker is required");
+
+	bool bOwnGIL = !py_own_gil || PyObject_IsTrue(py_own_gil);
+#if UEPY_OWN_GIL_INTERPRETERS
+	PythonInterpreterPool.MainInterpreter = PyInterpreterState_Get();
+	// initialized here as it is not thread safe
+	PyModuleDef_Init(&ue_py_pool_module);
+#else
+	bOwnGIL = false;
+#endif
+
+	PythonInterpreterPool.SysPath.Empty();
+	PyObject *py_sys_path = PySys_GetObject("path");
+	if (py_sys_path && PyList_Check(py_sys_path))
+	{
+		for (Py_ssize_t i = 0; i < PyList_Size(py_sys_path); i++)
+		{
+			PyObject *py_item = PyList_GetItem(py_sys_path, i);
+			if (PyUnicode_Check(py_item))
+				PythonInterpreterPool.SysPath.Add(UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_item)));
+		}
+	}
+
+	PythonInterpreterPool.Start(workers, bOwnGIL);
+
+	if (bOwnGIL)
+		Py_RETURN_TRUE;
+	Py_RETURN_FALSE;
+}
+
+PyObject *py_unreal_engine_interpreter_pool_stop(PyObject * self, PyObject * args)
+{
+	Py_BEGIN_ALLOW_THREADS;
+	PythonInterpreterPool.Stop();
+	Py_END_ALLOW_THREADS;
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_interpreter_pool_submit(PyObject * self, PyObject * args)
+{
+	char *module_name;
+	char *function_name;
+	PyObject *py_args = nullptr;
+	if (!PyArg_ParseTuple(args, "ss|O:interpreter_pool_submit", &module_name, &function_name, &py_args))
+	{
+		return nullptr;
+	}
+
+	if (!PythonInterpreterPool.IsRunning())
+		return PyErr_Format(PyExc_Exception, "interpreter pool is not running");
+
+	FPythonPoolJob *Job = new FPythonPoolJob();
+	Job->Module = UTF8_TO_TCHAR(module_name);
+	Job->Function = UTF8_TO_TCHAR(function_name);
+
+	if (py_args && py_args != Py_None)
+	{
+		PyObject *py_iter = PyObject_GetIter(py_args);
+		if (!py_iter)
+		{
+			delete Job;
+			return PyErr_Format(PyExc_TypeError, "job arguments must be an iterable");
+		}
+
+		bool bConverted = true;
+		while (PyObject *py_item = PyIter_Next(py_iter))
+		{
+			int32 Arg = Job->Args.AddDefaulted();
+			bConverted = ue_py_pool_value_from_pyobject(py_item, Job->Args[Arg], &Job->Buffers);
+			Py_DECREF(py_item);
+			if (!bConverted)
+				break;
+		}
+		Py_DECREF(py_iter);
+
+		if (!bConverted || PyErr_Occurred())
+		{
+			for (Py_buffer &Buffer : Job->Buffers)
+			{
+				PyBuffer_Release(&Buffer);
+			}
+			delete Job;
+			return nullptr;
+		}
+	}
+
+	Job->State = MakeShareable(new FPyGraphTaskState());
+	Job->Gate = TGraphTask<FNullGraphTask>::CreateTask(nullptr, ENamedThreads::AnyThread).ConstructAndHold(TStatId(), ENamedThreads::AnyThread);
+	Job->State->Event = Job->Gate->GetCompletionEvent();
+
+	// the handle is created before submitting, so a failure will not be logged as unretrieved
+	PyObject *py_handle = py_ue_new_fgraph_task(Job->State);
+	PythonInterpreterPool.Submit(Job);
+	return py_handle;
+}
+
+PyObject *py_unreal_engine_interpreter_pool_stats(PyObject * self, PyObject * args)
+{
+	int32 Queued = 0;
+	{
+		FScopeLock Lock(&PythonInterpreterPool.QueueLock);
+		Queued = PythonInterpreterPool.Queue.Num();
+	}
+
+	PyObject *py_stats = PyDict_New();
+	PyObject *py_value = PyLong_FromLong(PythonInterpreterPool.Workers.Num());
+	PyDict_SetItemString(py_stats, "workers", py_value);
+	Py_DECREF(py_value);
+	PyDict_SetItemString(py_stats, "own_gil", PythonInterpreterPool.IsRunning() && PythonInterpreterPool.bOwnGIL ? Py_True : Py_False);
+	py_value = PyLong_FromLong(Queued);
+	PyDict_SetItemString(py_stats, "queued", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromLong(PythonInterpreterPool.Submitted.GetValue());
+	PyDict_SetItemString(py_stats, "submitted", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromLong(PythonInterpreterPool.Completed.GetValue());
+	PyDict_SetItemString(py_stats, "completed", py_value);
+	Py_DECREF(py_value);
+	return py_stats;
+}
+
+void ue_python_stop_interpreter_pool()
+{
+	PythonInterpreterPool.Stop();
+}
+
+#endif
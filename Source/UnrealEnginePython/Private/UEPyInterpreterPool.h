@@ -0,0 +1,17 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#if PY_MAJOR_VERSION >= 3
+
+// pool of worker threads running python jobs, each one in its own sub-interpreter (with its own GIL on python >= 3.12)
+
+PyObject *py_unreal_engine_interpreter_pool_start(PyObject *, PyObject *);
+PyObject *py_unreal_engine_interpreter_pool_stop(PyObject *, PyObject *);
+PyObject *py_unreal_engine_interpreter_pool_submit(PyObject *, PyObject *);
+PyObject *py_unreal_engine_interpreter_pool_stats(PyObject *, PyObject *);
+
+// joins the workers, must be called without holding the GIL
+void ue_python_stop_interpreter_pool();
+
+#endif
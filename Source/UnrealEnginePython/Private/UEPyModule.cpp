@@ -59,6 +59,16 @@
 #include "Wrappers/UEPyFLinearColor.h"
 #include "Wrappers/UEPyFSocket.h"
 #include "Wrappers/UEPyFQuat.h"
+#include "Wrappers/UEPyFArrayPropertyView.h"
+#include "Wrappers/UEPyFTextureMipLock.h"
+#include "Wrappers/UEPyFVectorArray.h"
+#include "Wrappers/UEPyFRotatorArray.h"
+#include "Wrappers/UEPyFTransformArray.h"
+#include "Wrappers/UEPyFObjectIterator.h"
+#include "Wrappers/UEPyFGraphTask.h"
+#include "UEPyAsyncLoop.h"
+#include "UEPyInterpreterPool.h"
+#include "UEPyRenderTargetReadback.h"
 
 #include "Wrappers/UEPyFRawAnimSequenceTrack.h"
 
@@ -85,6 +95,10 @@
 #include "UEPyUStructsImporter.h"
 
 #include "UEPyUScriptStruct.h"
+#include "UEPyAttributeCache.h"
+#include "UEPyWrapperFreeList.h"
+#include "UEPyUFunctionCallPlan.h"
+#include "UEPyPropertyConverters.h"
 
 #if WITH_EDITOR
 #include "Wrappers/UEPyFSlowTask.h"
@@ -155,6 +169,28 @@ static PyObject* py_unreal_engine_py_gc(PyObject* self, PyObject* args)
 
 }
 
+static PyObject* py_unreal_engine_set_housekeeper_incremental_gc(PyObject* self, PyObject* args)
+{
+	PyObject* py_enabled;
+	float budget_ms = 1;
+	int max_entries = 4096;
+	if (!PyArg_ParseTuple(args, "O|fi:set_housekeeper_incremental_gc", &py_enabled, &budget_ms, &max_entries))
+	{
+		return NULL;
+	}
+
+	if (budget_ms < 0 || max_entries <= 0)
+		return PyErr_Format(PyExc_ValueError, "invalid incremental gc budget");
+
+	FUnrealEnginePythonHouseKeeper::Get()->SetIncrementalGC(PyObject_IsTrue(py_enabled) ? true : false, budget_ms, max_entries);
+	Py_RETURN_NONE;
+}
+
+static PyObject* py_unreal_engine_get_housekeeper_gc_stats(PyObject* self, PyObject* args)
+{
+	return FUnrealEnginePythonHouseKeeper::Get()->GetGCStats();
+}
+
 static PyObject* py_unreal_engine_exec(PyObject* self, PyObject* args)
 {
 	char* filename = nullptr;
@@ -267,9 +303,14 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "object_path_to_package_name", py_unreal_engine_object_path_to_package_name, METH_VARARGS, "" },
 
 	{ "compress_image_array", py_unreal_engine_compress_image_array, METH_VARARGS, "" },
+#pragma warning(suppress: 4191)
+	{ "compress_images", (PyCFunction)py_unreal_engine_compress_images, METH_VARARGS | METH_KEYWORDS, "" },
 	{ "create_checkerboard_texture", py_unreal_engine_create_checkerboard_texture, METH_VARARGS, "" },
 	{ "create_transient_texture", py_unreal_engine_create_transient_texture, METH_VARARGS, "" },
 	{ "create_transient_texture_render_target2d", py_unreal_engine_create_transient_texture_render_target2d, METH_VARARGS, "" },
+	{ "set_render_target_readback_slots", py_unreal_engine_set_render_target_readback_slots, METH_VARARGS, "" },
+	{ "flush_render_target_readbacks", py_unreal_engine_flush_render_target_readbacks, METH_VARARGS, "" },
+	{ "texture_lock_batch", py_unreal_engine_texture_lock_batch, METH_VARARGS, "" },
 #if WITH_EDITOR
 	{ "create_texture", py_unreal_engine_create_texture, METH_VARARGS, "" },
 #endif
@@ -432,20 +473,50 @@ static PyMethodDef unreal_engine_methods[] = {
 #endif
 	{ "slate_tick", py_unreal_engine_slate_tick, METH_VARARGS, "" },
 	{ "get_delta_time", py_unreal_engine_get_delta_time, METH_VARARGS, "" },
+	{ "flush_coalesced_events", py_unreal_engine_flush_coalesced_events, METH_VARARGS, "" },
 
 	{ "new_object", py_unreal_engine_new_object, METH_VARARGS, "" },
 
 
 	{ "get_mutable_default", py_unreal_engine_get_mutable_default, METH_VARARGS, "" },
 
+	{ "get_actors_locations", py_unreal_engine_get_actors_locations, METH_VARARGS, "" },
+	{ "get_actors_rotations", py_unreal_engine_get_actors_rotations, METH_VARARGS, "" },
+	{ "get_actors_scales", py_unreal_engine_get_actors_scales, METH_VARARGS, "" },
+	{ "get_actors_transforms", py_unreal_engine_get_actors_transforms, METH_VARARGS, "" },
+	{ "set_actors_locations", py_unreal_engine_set_actors_locations, METH_VARARGS, "" },
+	{ "set_actors_rotations", py_unreal_engine_set_actors_rotations, METH_VARARGS, "" },
+	{ "set_actors_scales", py_unreal_engine_set_actors_scales, METH_VARARGS, "" },
+	{ "set_actors_transforms", py_unreal_engine_set_actors_transforms, METH_VARARGS, "" },
+
 	{ "all_classes", (PyCFunction)py_unreal_engine_all_classes, METH_VARARGS, "" },
 	{ "all_worlds", (PyCFunction)py_unreal_engine_all_worlds, METH_VARARGS, "" },
 	{ "tobject_iterator", (PyCFunction)py_unreal_engine_tobject_iterator, METH_VARARGS, "" },
+	{ "iter_objects", (PyCFunction)py_unreal_engine_iter_objects, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "iter_classes", (PyCFunction)py_unreal_engine_iter_classes, METH_VARARGS, "" },
+
+	{ "set_python_tick_lod", py_unreal_engine_set_python_tick_lod, METH_VARARGS, "" },
+	{ "set_python_tick_schedule", py_unreal_engine_set_python_tick_schedule, METH_VARARGS, "" },
+	{ "get_python_tick_stats", py_unreal_engine_get_python_tick_stats, METH_VARARGS, "" },
 
 	{ "new_class", py_unreal_engine_new_class, METH_VARARGS, "" },
 
 
 	{ "create_and_dispatch_when_ready", py_unreal_engine_create_and_dispatch_when_ready, METH_VARARGS, "" },
+	{ "when_all", py_unreal_engine_when_all, METH_VARARGS, "" },
+
+#if PY_MAJOR_VERSION >= 3
+	{ "get_event_loop", py_unreal_engine_get_event_loop, METH_VARARGS, "" },
+	{ "set_event_loop_budget", py_unreal_engine_set_event_loop_budget, METH_VARARGS, "" },
+	{ "next_frame", py_unreal_engine_next_frame, METH_VARARGS, "" },
+	{ "delay", py_unreal_engine_delay, METH_VARARGS, "" },
+	{ "load_object_async", py_unreal_engine_load_object_async, METH_VARARGS, "" },
+
+	{ "interpreter_pool_start", py_unreal_engine_interpreter_pool_start, METH_VARARGS, "" },
+	{ "interpreter_pool_stop", py_unreal_engine_interpreter_pool_stop, METH_VARARGS, "" },
+	{ "interpreter_pool_submit", py_unreal_engine_interpreter_pool_submit, METH_VARARGS, "" },
+	{ "interpreter_pool_stats", py_unreal_engine_interpreter_pool_stats, METH_VARARGS, "" },
+#endif
 #if PLATFORM_MAC
 	{ "main_thread_call", py_unreal_engine_main_thread_call, METH_VARARGS, "" },
 #endif
@@ -454,6 +525,13 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "remove_ticker", py_unreal_engine_remove_ticker, METH_VARARGS, "" },
 
 	{ "py_gc", py_unreal_engine_py_gc, METH_VARARGS, "" },
+	{ "set_housekeeper_incremental_gc", py_unreal_engine_set_housekeeper_incremental_gc, METH_VARARGS, "" },
+	{ "get_housekeeper_gc_stats", py_unreal_engine_get_housekeeper_gc_stats, METH_VARARGS, "" },
+	{ "get_attribute_cache_stats", py_unreal_engine_get_attribute_cache_stats, METH_VARARGS, "" },
+	{ "clear_attribute_cache", py_unreal_engine_clear_attribute_cache, METH_VARARGS, "" },
+	{ "get_wrapper_freelist_stats", py_unreal_engine_get_wrapper_freelist_stats, METH_VARARGS, "" },
+	{ "set_wrapper_freelist_capacity", py_unreal_engine_set_wrapper_freelist_capacity, METH_VARARGS, "" },
+	{ "clear_wrapper_freelists", py_unreal_engine_clear_wrapper_freelists, METH_VARARGS, "" },
 	// exec is a reserved keyword in python2
 #if PY_MAJOR_VERSION >= 3
 	{ "exec", py_unreal_engine_exec, METH_VARARGS, "" },
@@ -466,7 +544,9 @@ static PyMethodDef unreal_engine_methods[] = {
 
 	{ "get_engine_defined_action_mappings", py_unreal_engine_get_engine_defined_action_mappings, METH_VARARGS, "" },
 
-	{ "get_viewport_screenshot", py_unreal_engine_get_viewport_screenshot, METH_VARARGS, "" },
+#pragma warning(suppress: 4191)
+	{ "get_viewport_screenshot", (PyCFunction)py_unreal_engine_get_viewport_screenshot, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "get_viewport_screenshot_async", py_unreal_engine_get_viewport_screenshot_async, METH_VARARGS, "" },
 	{ "get_viewport_size", py_unreal_engine_get_viewport_size, METH_VARARGS, "" },
 	{ "get_resolution", py_unreal_engine_get_resolution, METH_VARARGS, "" },
 	{ "get_game_viewport_size", py_unreal_engine_get_game_viewport_size, METH_VARARGS, "" },
@@ -480,8 +560,10 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "editor_play_in_viewport", py_unreal_engine_editor_play_in_viewport, METH_VARARGS, "" },
 	{ "request_play_session", py_unreal_engine_request_play_session, METH_VARARGS, "" },
 	{ "get_editor_pie_game_viewport_client", py_unreal_engine_get_editor_pie_game_viewport_client, METH_VARARGS, "" },
-	{ "editor_get_active_viewport_screenshot", py_unreal_engine_editor_get_active_viewport_screenshot, METH_VARARGS, "" },
-	{ "editor_get_pie_viewport_screenshot", py_unreal_engine_editor_get_pie_viewport_screenshot, METH_VARARGS, "" },
+#pragma warning(suppress: 4191)
+	{ "editor_get_active_viewport_screenshot", (PyCFunction)py_unreal_engine_editor_get_active_viewport_screenshot, METH_VARARGS | METH_KEYWORDS, "" },
+#pragma warning(suppress: 4191)
+	{ "editor_get_pie_viewport_screenshot", (PyCFunction)py_unreal_engine_editor_get_pie_viewport_screenshot, METH_VARARGS | METH_KEYWORDS, "" },
 
 	{ "editor_set_view_mode", py_unreal_engine_editor_set_view_mode, METH_VARARGS, "" },
 	{ "editor_set_camera_speed", py_unreal_engine_editor_set_camera_speed, METH_VARARGS, "" },
@@ -497,7 +579,8 @@ static PyMethodDef unreal_engine_methods[] = {
 	{ "show_viewer", py_unreal_engine_show_viewer, METH_VARARGS, "" },
 	{ "unregister_settings", py_unreal_engine_unregister_settings, METH_VARARGS, "" },
 
-	{ "in_editor_capture", py_unreal_engine_in_editor_capture, METH_VARARGS, "" },
+#pragma warning(suppress: 4191)
+	{ "in_editor_capture", (PyCFunction)py_unreal_engine_in_editor_capture, METH_VARARGS | METH_KEYWORDS, "" },
 #endif
 
 	{ "clipboard_copy", py_unreal_engine_clipboard_copy, METH_VARARGS, "" },
@@ -572,6 +655,7 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	{ "get_uproperty", (PyCFunction)py_ue_get_uproperty, METH_VARARGS, "" },
 	{ "get_property_struct", (PyCFunction)py_ue_get_property_struct, METH_VARARGS, "" },
 	{ "get_property_array_dim", (PyCFunction)py_ue_get_property_array_dim, METH_VARARGS, "" },
+	{ "get_property_view", (PyCFunction)py_ue_get_property_view, METH_VARARGS, "" },
 	{ "get_inner", (PyCFunction)py_ue_get_inner, METH_VARARGS, "" },
 	{ "get_key_prop", (PyCFunction)py_ue_get_key_prop, METH_VARARGS, "" },
 	{ "get_value_prop", (PyCFunction)py_ue_get_value_prop, METH_VARARGS, "" },
@@ -609,6 +693,9 @@ static PyMethodDef ue_PyUObject_methods[] = {
 
 	{ "bind_event", (PyCFunction)py_ue_bind_event, METH_VARARGS, "" },
 	{ "unbind_event", (PyCFunction)py_ue_unbind_event, METH_VARARGS, "" },
+#if PY_MAJOR_VERSION >= 3
+	{ "wait_event", (PyCFunction)py_ue_wait_event, METH_VARARGS, "" },
+#endif
 	{ "delegate_bind_ufunction", (PyCFunction)py_ue_delegate_bind_ufunction, METH_VARARGS, "" },
 
 	{ "get_py_proxy", (PyCFunction)py_ue_get_py_proxy, METH_VARARGS, "" },
@@ -716,6 +803,9 @@ static PyMethodDef ue_PyUObject_methods[] = {
 
 	{ "all_objects", (PyCFunction)py_ue_all_objects, METH_VARARGS, "" },
 	{ "all_actors", (PyCFunction)py_ue_all_actors, METH_VARARGS, "" },
+	{ "iter_objects", (PyCFunction)py_ue_iter_objects, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "iter_actors", (PyCFunction)py_ue_iter_actors, METH_VARARGS | METH_KEYWORDS, "" },
+	{ "query_actors", (PyCFunction)py_ue_query_actors, METH_VARARGS | METH_KEYWORDS, "" },
 
 
 	// Package
@@ -1069,11 +1159,13 @@ static PyMethodDef ue_PyUObject_methods[] = {
 	// Texture
 	{ "texture_get_data", (PyCFunction)py_ue_texture_get_data, METH_VARARGS, "" },
 	{ "texture_set_data", (PyCFunction)py_ue_texture_set_data, METH_VARARGS, "" },
+	{ "texture_lock_mip", (PyCFunction)py_ue_texture_lock_mip, METH_VARARGS, "" },
 	{ "texture_get_width", (PyCFunction)py_ue_texture_get_width, METH_VARARGS, "" },
 	{ "texture_get_height", (PyCFunction)py_ue_texture_get_height, METH_VARARGS, "" },
 	{ "texture_has_alpha_channel", (PyCFunction)py_ue_texture_has_alpha_channel, METH_VARARGS, "" },
 	{ "render_target_get_data", (PyCFunction)py_ue_render_target_get_data, METH_VARARGS, "" },
 	{ "render_target_get_data_to_buffer", (PyCFunction)py_ue_render_target_get_data_to_buffer, METH_VARARGS, "" },
+	{ "render_target_get_data_async", (PyCFunction)py_ue_render_target_get_data_async, METH_VARARGS, "" },
 	{ "texture_update_resource", (PyCFunction)py_ue_texture_update_resource, METH_VARARGS, "" },
 
 #if WITH_EDITOR
@@ -1191,6 +1283,8 @@ static void ue_pyobject_dealloc(ue_PyUObject* self)
 	if (self->owned)
 	{
 		FUnrealEnginePythonHouseKeeper::Get()->UntrackUObject(self->ue_object);
+		// the housekeeper does not hold a reference to owned wrappers
+		FUnrealEnginePythonHouseKeeper::Get()->ForgetPyUObject(self);
 	}
 
 	if (self->auto_rooted && (self->ue_object && self->ue_object->IsValidLowLevel() && self->ue_object->IsRooted()))
@@ -1203,112 +1297,188 @@ static void ue_pyobject_dealloc(ue_PyUObject* self)
 	Py_TYPE(self)->tp_free((PyObject*)self);
 }
 
-static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
+// resolve an attribute name using the Unreal reflection system (properties, functions, static functions and enums)
+static void ue_py_resolve_attribute(UObject* u_object, const char* attr, FPyAttributeCacheEntry& entry)
 {
-	ue_py_check(self);
+	entry.Kind = EPyAttributeKind::Missing;
 
-	PyObject* ret = PyObject_GenericGetAttr((PyObject*)self, attr_name);
-	if (!ret)
+	// first check for property
+	UStruct* u_struct = nullptr;
+	if (u_object->IsA<UStruct>())
 	{
-		if (PyUnicodeOrString_Check(attr_name))
-		{
-			const char* attr = UEPyUnicode_AsUTF8(attr_name);
-			// first check for property
-			UStruct* u_struct = nullptr;
-			if (self->ue_object->IsA<UStruct>())
-			{
-				u_struct = (UStruct*)self->ue_object;
-			}
-			else
-			{
-				u_struct = (UStruct*)self->ue_object->GetClass();
-			}
-			UProperty* u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
-			if (u_property)
-			{
-				// swallow previous exception
-				PyErr_Clear();
-				return ue_py_convert_property(u_property, (uint8*)self->ue_object, 0);
-			}
+		u_struct = (UStruct*)u_object;
+	}
+	else
+	{
+		u_struct = (UStruct*)u_object->GetClass();
+	}
+	UProperty* u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
+	if (u_property)
+	{
+		entry.Kind = EPyAttributeKind::Property;
+		entry.Property = u_property;
+		return;
+	}
 
-			UFunction* function = self->ue_object->FindFunction(FName(UTF8_TO_TCHAR(attr)));
-			// retry wth K2_ prefix
-			if (!function)
-			{
-				FString k2_name = FString("K2_") + UTF8_TO_TCHAR(attr);
-				function = self->ue_object->FindFunction(FName(*k2_name));
-			}
+	UFunction* function = u_object->FindFunction(FName(UTF8_TO_TCHAR(attr)));
+	// retry wth K2_ prefix
+	if (!function)
+	{
+		FString k2_name = FString("K2_") + UTF8_TO_TCHAR(attr);
+		function = u_object->FindFunction(FName(*k2_name));
+	}
 
-			// is it a static class ?
-			if (!function)
+	// is it a static class ?
+	if (!function)
+	{
+		if (u_object->IsA<UClass>())
+		{
+			UClass* u_class = (UClass*)u_object;
+			UObject* cdo = u_class->GetDefaultObject();
+			if (cdo)
 			{
-				if (self->ue_object->IsA<UClass>())
+				function = cdo->FindFunction(FName(UTF8_TO_TCHAR(attr)));
+				// try _NEW ?
+				if (!function)
 				{
-					UClass* u_class = (UClass*)self->ue_object;
-					UObject* cdo = u_class->GetDefaultObject();
-					if (cdo)
-					{
-						function = cdo->FindFunction(FName(UTF8_TO_TCHAR(attr)));
-						// try _NEW ?
-						if (!function)
-						{
-							FString name_new = UTF8_TO_TCHAR(attr) + FString("_NEW");
-							function = cdo->FindFunction(FName(*name_new));
-						}
-					}
+					FString name_new = UTF8_TO_TCHAR(attr) + FString("_NEW");
+					function = cdo->FindFunction(FName(*name_new));
 				}
 			}
+		}
+	}
 
-			// last hope, is it an enum ?
-			if (!function)
-			{
+	if (function)
+	{
+		entry.Kind = EPyAttributeKind::Function;
+		entry.Function = function;
+		return;
+	}
+
+	// last hope, is it an enum ?
 #if ENGINE_MINOR_VERSION >= 15
-				if (self->ue_object->IsA<UUserDefinedEnum>())
-				{
-					UUserDefinedEnum* u_enum = (UUserDefinedEnum*)self->ue_object;
-					PyErr_Clear();
-					FString attr_as_string = FString(UTF8_TO_TCHAR(attr));
-					for (auto item : u_enum->DisplayNameMap)
-					{
-						if (item.Value.ToString() == attr_as_string)
-						{
+	if (u_object->IsA<UUserDefinedEnum>())
+	{
+		UUserDefinedEnum* u_enum = (UUserDefinedEnum*)u_object;
+		entry.Kind = EPyAttributeKind::UnknownEnumName;
+		FString attr_as_string = FString(UTF8_TO_TCHAR(attr));
+		for (auto item : u_enum->DisplayNameMap)
+		{
+			if (item.Value.ToString() == attr_as_string)
+			{
+				entry.Kind = EPyAttributeKind::EnumValue;
 #if ENGINE_MINOR_VERSION > 15
-							return PyLong_FromLong(u_enum->GetIndexByName(item.Key));
+				entry.EnumValue = u_enum->GetIndexByName(item.Key);
 #else
-							return PyLong_FromLong(u_enum->FindEnumIndex(item.Key));
+				entry.EnumValue = u_enum->FindEnumIndex(item.Key);
 #endif
-						}
-					}
-					return PyErr_Format(PyExc_Exception, "unknown enum name \"%s\"", attr);
-				}
+				break;
+			}
+		}
+		return;
+	}
 #endif
-				if (self->ue_object->IsA<UEnum>())
-				{
-					UEnum* u_enum = (UEnum*)self->ue_object;
-					PyErr_Clear();
+	if (u_object->IsA<UEnum>())
+	{
+		UEnum* u_enum = (UEnum*)u_object;
 #if ENGINE_MINOR_VERSION > 15
-					int32 value = u_enum->GetIndexByName(FName(UTF8_TO_TCHAR(attr)));
-					if (value == INDEX_NONE)
-						return PyErr_Format(PyExc_Exception, "unknown enum name \"%s\"", attr);
-					return PyLong_FromLong(value);
+		int32 value = u_enum->GetIndexByName(FName(UTF8_TO_TCHAR(attr)));
 #else
-					int32 value = u_enum->FindEnumIndex(FName(UTF8_TO_TCHAR(attr)));
-					if (value == INDEX_NONE)
-						return PyErr_Format(PyExc_Exception, "unknown enum name \"%s\"", attr);
-					return PyLong_FromLong(value);
+		int32 value = u_enum->FindEnumIndex(FName(UTF8_TO_TCHAR(attr)));
 #endif
-				}
-			}
+		if (value == INDEX_NONE)
+		{
+			entry.Kind = EPyAttributeKind::UnknownEnumName;
+			return;
+		}
+		entry.Kind = EPyAttributeKind::EnumValue;
+		entry.EnumValue = value;
+	}
+}
 
-			if (function)
-			{
-				// swallow previous exception
-				PyErr_Clear();
-				return py_ue_new_callable(function, self->ue_object);
-			}
+static PyObject* ue_py_attribute_from_entry(ue_PyUObject* self, const FPyAttributeCacheEntry& entry, PyObject* attr_name)
+{
+	switch (entry.Kind)
+	{
+	case EPyAttributeKind::Property:
+		return ue_py_convert_property(entry.Property, (uint8*)self->ue_object, 0);
+	case EPyAttributeKind::Function:
+		return py_ue_new_callable(entry.Function, self->ue_object);
+	case EPyAttributeKind::EnumValue:
+		return PyLong_FromLong((long)entry.EnumValue);
+	case EPyAttributeKind::UnknownEnumName:
+		return PyErr_Format(PyExc_Exception, "unknown enum name \"%s\"", UEPyUnicode_AsUTF8(attr_name));
+	default:
+		break;
+	}
+	return PyErr_Format(PyExc_AttributeError, "unable to resolve attribute");
+}
+
+static PyObject* ue_PyUObject_getattro(ue_PyUObject* self, PyObject* attr_name)
+{
+	ue_py_check(self);
+
+	FUnrealEnginePythonAttributeCache* AttributeCache = FUnrealEnginePythonAttributeCache::Get();
+	UObject* scope = FUnrealEnginePythonAttributeCache::GetScope(self->ue_object);
+	PyObject* interned_name = FUnrealEnginePythonAttributeCache::InternName(attr_name);
+
+	FPyAttributeCacheEntry entry;
+	bool has_entry = false;
+	if (interned_name)
+	{
+		if (FPyAttributeCacheEntry* cached_entry = AttributeCache->Find(scope, interned_name))
+		{
+			entry = *cached_entry;
+			has_entry = true;
 		}
 	}
-	return ret;
+
+	bool is_base_type = Py_TYPE(self) == &ue_PyUObjectType;
+
+	// fast path: the base type has no python attribute with this name, so only the __dict__ can shadow it
+	if (has_entry && entry.bTypeMiss && is_base_type &&
+		entry.Kind != EPyAttributeKind::Missing && entry.Kind != EPyAttributeKind::PythonAttribute &&
+		!PyDict_GetItem(self->py_dict, interned_name))
+	{
+		Py_DECREF(interned_name);
+		return ue_py_attribute_from_entry(self, entry, attr_name);
+	}
+
+	PyObject* ret = PyObject_GenericGetAttr((PyObject*)self, attr_name);
+	if (ret || !PyUnicodeOrString_Check(attr_name))
+	{
+		if (ret && interned_name && !has_entry)
+		{
+			FPyAttributeCacheEntry python_entry;
+			python_entry.Kind = EPyAttributeKind::PythonAttribute;
+			AttributeCache->Add(scope, interned_name, python_entry);
+		}
+		Py_XDECREF(interned_name);
+		return ret;
+	}
+
+	if (!has_entry || entry.Kind == EPyAttributeKind::PythonAttribute || (is_base_type && !entry.bTypeMiss))
+	{
+		if (!has_entry || entry.Kind == EPyAttributeKind::PythonAttribute)
+		{
+			ue_py_resolve_attribute(self->ue_object, UEPyUnicode_AsUTF8(attr_name), entry);
+		}
+		entry.bTypeMiss = entry.bTypeMiss || is_base_type;
+		if (interned_name)
+		{
+			AttributeCache->Add(scope, interned_name, entry);
+		}
+	}
+	Py_XDECREF(interned_name);
+
+	if (entry.Kind == EPyAttributeKind::Missing)
+	{
+		return ret;
+	}
+
+	// swallow previous exception
+	PyErr_Clear();
+	return ue_py_attribute_from_entry(self, entry, attr_name);
 }
 
 static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObject* value)
@@ -1319,17 +1489,32 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 	if (PyUnicodeOrString_Check(attr_name))
 	{
 		const char* attr = UEPyUnicode_AsUTF8(attr_name);
-		// first check for property
-		UStruct* u_struct = nullptr;
-		if (self->ue_object->IsA<UStruct>())
+		UProperty* u_property = nullptr;
+		// properties already resolved by getattro do not need a FName lookup
+		PyObject* interned_name = FUnrealEnginePythonAttributeCache::InternName(attr_name);
+		if (interned_name)
 		{
-			u_struct = (UStruct*)self->ue_object;
+			FPyAttributeCacheEntry* entry = FUnrealEnginePythonAttributeCache::Get()->Find(FUnrealEnginePythonAttributeCache::GetScope(self->ue_object), interned_name);
+			if (entry && entry->Kind == EPyAttributeKind::Property)
+			{
+				u_property = entry->Property;
+			}
+			Py_DECREF(interned_name);
 		}
-		else
+		// first check for property
+		if (!u_property)
 		{
-			u_struct = (UStruct*)self->ue_object->GetClass();
+			UStruct* u_struct = nullptr;
+			if (self->ue_object->IsA<UStruct>())
+			{
+				u_struct = (UStruct*)self->ue_object;
+			}
+			else
+			{
+				u_struct = (UStruct*)self->ue_object->GetClass();
+			}
+			u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
 		}
-		UProperty* u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(attr)));
 		if (u_property)
 		{
 #if WITH_EDITOR
@@ -1363,7 +1548,8 @@ static int ue_PyUObject_setattro(ue_PyUObject* self, PyObject* attr_name, PyObje
 #endif
 				return 0;
 			}
-			PyErr_SetString(PyExc_ValueError, "invalid value for UProperty");
+			if (!PyErr_Occurred())
+				PyErr_SetString(PyExc_ValueError, "invalid value for UProperty");
 			return -1;
 		}
 
@@ -1630,6 +1816,9 @@ UClass* unreal_engine_new_uclass(char* name, UClass* outer_parent)
 	}
 #endif
 
+	// the fields of an overwritten class (and of its subclasses) have been regenerated
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+
 	return new_object;
 }
 
@@ -1672,6 +1861,13 @@ void unreal_engine_init_py_module()
 	ue_python_init_fcolor(new_unreal_engine_module);
 	ue_python_init_flinearcolor(new_unreal_engine_module);
 	ue_python_init_fquat(new_unreal_engine_module);
+	ue_python_init_farray_property_view(new_unreal_engine_module);
+	ue_python_init_ftexture_mip_lock(new_unreal_engine_module);
+	ue_python_init_fvector_array(new_unreal_engine_module);
+	ue_python_init_frotator_array(new_unreal_engine_module);
+	ue_python_init_ftransform_array(new_unreal_engine_module);
+	ue_python_init_fobject_iterator(new_unreal_engine_module);
+	ue_python_init_fgraph_task(new_unreal_engine_module);
 
 #if ENGINE_MINOR_VERSION >= 20
 	ue_python_init_fframe_number(new_unreal_engine_module);
@@ -1778,6 +1974,10 @@ void unreal_engine_init_py_module()
 	PyDict_SetItemString(unreal_engine_dict, "IE_RELEASED", PyLong_FromLong(EInputEvent::IE_Released));
 	PyDict_SetItemString(unreal_engine_dict, "IE_REPEAT", PyLong_FromLong(EInputEvent::IE_Repeat));
 
+	// TaskGraph
+	PyDict_SetItemString(unreal_engine_dict, "NAMED_THREAD_ANY", PyLong_FromLong(ENamedThreads::AnyThread));
+	PyDict_SetItemString(unreal_engine_dict, "NAMED_THREAD_GAME", PyLong_FromLong(ENamedThreads::GameThread));
+
 	// Classes
 	PyDict_SetItemString(unreal_engine_dict, "CLASS_CONFIG", PyLong_FromUnsignedLongLong((uint64)CLASS_Config));
 	PyDict_SetItemString(unreal_engine_dict, "CLASS_DEFAULT_CONFIG", PyLong_FromUnsignedLongLong((uint64)CLASS_DefaultConfig));
@@ -2017,830 +2217,117 @@ AActor* ue_get_actor(ue_PyUObject* py_obj)
 // convert a property to a python object
 PyObject* ue_py_convert_property(UProperty* prop, uint8* buffer, int32 index)
 {
-	if (auto casted_prop = Cast<UBoolProperty>(prop))
-	{
-		bool value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		if (value)
-		{
-			Py_RETURN_TRUE;
-		}
-		Py_RETURN_FALSE;
-	}
+	return ue_py_get_property_converter(prop).ToPython(prop, buffer, index);
+}
 
-	if (auto casted_prop = Cast<UIntProperty>(prop))
-	{
-		int value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyLong_FromLong(value);
-	}
+// convert a python object to a property
+bool ue_py_convert_pyobject(PyObject* py_obj, UProperty* prop, uint8* buffer, int32 index)
+{
+	return ue_py_get_property_converter(prop).ToProperty(py_obj, prop, buffer, index);
+}
 
-	if (auto casted_prop = Cast<UUInt32Property>(prop))
-	{
-		uint32 value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyLong_FromUnsignedLong(value);
-	}
 
-	if (auto casted_prop = Cast<UInt64Property>(prop))
-	{
-		long long value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyLong_FromLongLong(value);
-	}
+// check if a python object is a wrapper to a UObject
+ue_PyUObject* ue_is_pyuobject(PyObject* obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject*)& ue_PyUObjectType))
+		return nullptr;
+	return (ue_PyUObject*)obj;
+}
 
-	if (auto casted_prop = Cast<UUInt64Property>(prop))
-	{
-		uint64 value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyLong_FromUnsignedLongLong(value);
-	}
+void ue_bind_events_for_py_class_by_attribute(UObject* u_obj, PyObject* py_class)
+{
+	// attempt to register events
+	PyObject* attrs = PyObject_Dir(py_class);
+	if (!attrs)
+		return;
 
-	if (auto casted_prop = Cast<UFloatProperty>(prop))
+	AActor* actor = Cast<AActor>(u_obj);
+	if (!actor)
 	{
-		float value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyFloat_FromDouble(value);
+		UActorComponent* component = Cast<UActorComponent>(u_obj);
+		if (!component)
+			return;
+		actor = component->GetOwner();
 	}
 
-	if (auto casted_prop = Cast<UByteProperty>(prop))
+	Py_ssize_t len = PyList_Size(attrs);
+	for (Py_ssize_t i = 0; i < len; i++)
 	{
-		uint8 value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyLong_FromUnsignedLong(value);
-	}
+		PyObject* py_attr_name = PyList_GetItem(attrs, i);
+		if (!py_attr_name || !PyUnicodeOrString_Check(py_attr_name))
+			continue;
+		PyObject* item = PyObject_GetAttrString(py_class, UEPyUnicode_AsUTF8(py_attr_name));
+		if (item && PyCallable_Check(item))
+		{
+			// check for ue_event signature
+			PyObject* event_signature = PyObject_GetAttrString(item, (char*)"ue_event");
+			if (event_signature)
+			{
+				if (PyUnicodeOrString_Check(event_signature))
+				{
+					FString event_name = FString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(event_signature)));
+					TArray<FString> parts;
+					int n = event_name.ParseIntoArray(parts, UTF8_TO_TCHAR("."));
+					if (n < 1 || n > 2)
+					{
+						PyErr_SetString(PyExc_Exception, "invalid ue_event syntax, must be the name of an event or ComponentName.Event");
+						unreal_engine_py_log_error();
+					}
+					else
+					{
+						if (n == 1)
+						{
+							if (!ue_bind_pyevent(ue_get_python_uobject(actor), parts[0], item, true))
+							{
+								unreal_engine_py_log_error();
+							}
+						}
+						else
+						{
+							bool found = false;
+							for (UActorComponent* component : actor->GetComponents())
+							{
+								if (component->GetFName() == FName(*parts[0]))
+								{
+									if (!ue_bind_pyevent(ue_get_python_uobject(component), parts[1], item, true))
+									{
+										unreal_engine_py_log_error();
+									}
+									found = true;
+									break;
+								}
+							}
 
-#if ENGINE_MINOR_VERSION >= 15
-	if (auto casted_prop = Cast<UEnumProperty>(prop))
-	{
-		void* prop_addr = casted_prop->ContainerPtrToValuePtr<void>(buffer, index);
-		uint64 enum_index = casted_prop->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(prop_addr);
-		return PyLong_FromUnsignedLong(enum_index);
+							if (!found)
+							{
+								PyErr_SetString(PyExc_Exception, "unable to find component by name");
+								unreal_engine_py_log_error();
+							}
+						}
+					}
+				}
+				else
+				{
+					PyErr_SetString(PyExc_Exception, "ue_event attribute must be a string");
+					unreal_engine_py_log_error();
+				}
+			}
+			Py_XDECREF(event_signature);
+		}
+		Py_XDECREF(item);
 	}
-#endif
+	Py_DECREF(attrs);
 
-	if (auto casted_prop = Cast<UStrProperty>(prop))
-	{
-		FString value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyUnicode_FromString(TCHAR_TO_UTF8(*value));
-	}
+	PyErr_Clear();
+}
 
-	if (auto casted_prop = Cast<UTextProperty>(prop))
-	{
-		FText value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyUnicode_FromString(TCHAR_TO_UTF8(*value.ToString()));
-	}
-
-	if (auto casted_prop = Cast<UNameProperty>(prop))
-	{
-		FName value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		return PyUnicode_FromString(TCHAR_TO_UTF8(*value.ToString()));
-	}
-
-	if (auto casted_prop = Cast<UObjectPropertyBase>(prop))
-	{
-		auto value = casted_prop->GetObjectPropertyValue_InContainer(buffer, index);
-		if (value)
-		{
-			Py_RETURN_UOBJECT(value);
-		}
-		Py_RETURN_NONE;
-	}
-
-	if (auto casted_prop = Cast<UClassProperty>(prop))
-	{
-		auto value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		if (value)
-		{
-			Py_RETURN_UOBJECT(value);
-		}
-		return PyErr_Format(PyExc_Exception, "invalid UClass type for %s", TCHAR_TO_UTF8(*casted_prop->GetName()));
-	}
-
-	// try to manage known struct first
-	if (auto casted_prop = Cast<UStructProperty>(prop))
-	{
-		if (auto casted_struct = Cast<UScriptStruct>(casted_prop->Struct))
-		{
-			if (casted_struct == TBaseStructure<FVector>::Get())
-			{
-				FVector vec = *casted_prop->ContainerPtrToValuePtr<FVector>(buffer, index);
-				return py_ue_new_fvector(vec);
-			}
-			if (casted_struct == TBaseStructure<FVector2D>::Get())
-			{
-				FVector2D vec = *casted_prop->ContainerPtrToValuePtr<FVector2D>(buffer, index);
-				return py_ue_new_fvector2d(vec);
-			}
-			if (casted_struct == TBaseStructure<FRotator>::Get())
-			{
-				FRotator rot = *casted_prop->ContainerPtrToValuePtr<FRotator>(buffer, index);
-				return py_ue_new_frotator(rot);
-			}
-			if (casted_struct == TBaseStructure<FTransform>::Get())
-			{
-				FTransform transform = *casted_prop->ContainerPtrToValuePtr<FTransform>(buffer, index);
-				return py_ue_new_ftransform(transform);
-			}
-			if (casted_struct == FHitResult::StaticStruct())
-			{
-				FHitResult hit = *casted_prop->ContainerPtrToValuePtr<FHitResult>(buffer, index);
-				return py_ue_new_fhitresult(hit);
-			}
-			if (casted_struct == TBaseStructure<FColor>::Get())
-			{
-				FColor color = *casted_prop->ContainerPtrToValuePtr<FColor>(buffer, index);
-				return py_ue_new_fcolor(color);
-			}
-			if (casted_struct == TBaseStructure<FLinearColor>::Get())
-			{
-				FLinearColor color = *casted_prop->ContainerPtrToValuePtr<FLinearColor>(buffer, index);
-				return py_ue_new_flinearcolor(color);
-			}
-			return py_ue_new_uscriptstruct(casted_struct, casted_prop->ContainerPtrToValuePtr<uint8>(buffer, index));
-		}
-		return PyErr_Format(PyExc_TypeError, "unsupported UStruct type");
-	}
-
-	if (auto casted_prop = Cast<UWeakObjectProperty>(prop))
-	{
-		auto value = casted_prop->GetPropertyValue_InContainer(buffer, index);
-		UObject* strong_obj = value.Get();
-		if (strong_obj)
-		{
-			Py_RETURN_UOBJECT(strong_obj);
-		}
-		// nullptr
-		Py_RETURN_NONE;
-	}
-
-	if (auto casted_prop = Cast<UMulticastDelegateProperty>(prop))
-	{
-		Py_RETURN_UOBJECT(casted_prop);
-	}
-
-	if (auto casted_prop = Cast<UDelegateProperty>(prop))
-	{
-		Py_RETURN_UOBJECT(casted_prop);
-	}
-
-	if (auto casted_prop = Cast<UArrayProperty>(prop))
-	{
-		FScriptArrayHelper_InContainer array_helper(casted_prop, buffer, index);
-
-		UProperty* array_prop = casted_prop->Inner;
-
-		// check for TArray<uint8>, so we can use bytearray optimization
-		if (auto uint8_tarray = Cast<UByteProperty>(array_prop))
-		{
-			uint8* buf = array_helper.GetRawPtr();
-			return PyByteArray_FromStringAndSize((char*)buf, array_helper.Num());
-		}
-
-		PyObject* py_list = PyList_New(0);
-
-		for (int i = 0; i < array_helper.Num(); i++)
-		{
-			PyObject* item = ue_py_convert_property(array_prop, array_helper.GetRawPtr(i), 0);
-			if (!item)
-			{
-				Py_DECREF(py_list);
-				return NULL;
-			}
-			PyList_Append(py_list, item);
-			Py_DECREF(item);
-		}
-
-		return py_list;
-	}
-
-#if ENGINE_MINOR_VERSION >= 15
-	if (auto casted_prop = Cast<UMapProperty>(prop))
-	{
-		FScriptMapHelper_InContainer map_helper(casted_prop, buffer, index);
-
-		PyObject* py_dict = PyDict_New();
-
-		for (int32 i = 0; i < map_helper.Num(); i++)
-		{
-			if (map_helper.IsValidIndex(i))
-			{
-
-				uint8* ptr = map_helper.GetPairPtr(i);
-
-				PyObject* py_key = ue_py_convert_property(map_helper.KeyProp, ptr, 0);
-				if (!py_key)
-				{
-					Py_DECREF(py_dict);
-					return NULL;
-				}
-
-				PyObject* py_value = ue_py_convert_property(map_helper.ValueProp, ptr, 0);
-				if (!py_value)
-				{
-					Py_DECREF(py_dict);
-					return NULL;
-				}
-
-				PyDict_SetItem(py_dict, py_key, py_value);
-				Py_DECREF(py_key);
-				Py_DECREF(py_value);
-			}
-		}
-
-		return py_dict;
-	}
-#endif
-
-	return PyErr_Format(PyExc_Exception, "unsupported value type %s for property %s", TCHAR_TO_UTF8(*prop->GetClass()->GetName()), TCHAR_TO_UTF8(*prop->GetName()));
-}
-
-// convert a python object to a property
-bool ue_py_convert_pyobject(PyObject* py_obj, UProperty* prop, uint8* buffer, int32 index)
-{
-
-	if (PyBool_Check(py_obj))
-	{
-		auto casted_prop = Cast<UBoolProperty>(prop);
-		if (!casted_prop)
-			return false;
-		if (PyObject_IsTrue(py_obj))
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, true, index);
-		}
-		else
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, false, index);
-		}
-		return true;
-	}
-
-	if (PyNumber_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UIntProperty>(prop))
-		{
-			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsLong(py_long), index);
-			Py_DECREF(py_long);
-			return true;
-		}
-		if (auto casted_prop = Cast<UUInt32Property>(prop))
-		{
-			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLong(py_long), index);
-			Py_DECREF(py_long);
-			return true;
-		}
-		if (auto casted_prop = Cast<UInt64Property>(prop))
-		{
-			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsLongLong(py_long), index);
-			Py_DECREF(py_long);
-			return true;
-		}
-		if (auto casted_prop = Cast<UUInt64Property>(prop))
-		{
-			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLongLong(py_long), index);
-			Py_DECREF(py_long);
-			return true;
-		}
-		if (auto casted_prop = Cast<UFloatProperty>(prop))
-		{
-			PyObject* py_float = PyNumber_Float(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyFloat_AsDouble(py_float), index);
-			Py_DECREF(py_float);
-			return true;
-		}
-		if (auto casted_prop = Cast<UByteProperty>(prop))
-		{
-			PyObject* py_long = PyNumber_Long(py_obj);
-			casted_prop->SetPropertyValue_InContainer(buffer, PyLong_AsUnsignedLong(py_long), index);
-			Py_DECREF(py_long);
-			return true;
-		}
-#if ENGINE_MINOR_VERSION >= 15
-		if (auto casted_prop = Cast<UEnumProperty>(prop))
-		{
-			PyObject* py_long = PyNumber_Long(py_obj);
-			void* prop_addr = casted_prop->ContainerPtrToValuePtr<void>(buffer, index);
-			casted_prop->GetUnderlyingProperty()->SetIntPropertyValue(prop_addr, (uint64)PyLong_AsUnsignedLong(py_long));
-			Py_DECREF(py_long);
-			return true;
-		}
-#endif
-
-
-		return false;
-	}
-
-	if (PyUnicodeOrString_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UStrProperty>(prop))
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
-			return true;
-		}
-		if (auto casted_prop = Cast<UNameProperty>(prop))
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
-			return true;
-		}
-		if (auto casted_prop = Cast<UTextProperty>(prop))
-		{
-			casted_prop->SetPropertyValue_InContainer(buffer, FText::FromString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj))), index);
-			return true;
-		}
-		return false;
-	}
-
-	if (PyBytes_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UArrayProperty>(prop))
-		{
-			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
-
-			if (auto item_casted_prop = Cast<UByteProperty>(casted_prop->Inner))
-			{
-
-				Py_ssize_t pybytes_len = PyBytes_Size(py_obj);
-				uint8* buf = (uint8*)PyBytes_AsString(py_obj);
-
-
-				// fix array helper size
-				if (helper.Num() < pybytes_len)
-				{
-					helper.AddValues(pybytes_len - helper.Num());
-				}
-				else if (helper.Num() > pybytes_len)
-				{
-					helper.RemoveValues(pybytes_len, helper.Num() - pybytes_len);
-				}
-
-
-				FMemory::Memcpy(helper.GetRawPtr(), buf, pybytes_len);
-				return true;
-			}
-		}
-
-		return false;
-	}
-
-	if (PyByteArray_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UArrayProperty>(prop))
-		{
-			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
-
-			if (auto item_casted_prop = Cast<UByteProperty>(casted_prop->Inner))
-			{
-
-				Py_ssize_t pybytes_len = PyByteArray_Size(py_obj);
-				uint8* buf = (uint8*)PyByteArray_AsString(py_obj);
-
-
-				// fix array helper size
-				if (helper.Num() < pybytes_len)
-				{
-					helper.AddValues(pybytes_len - helper.Num());
-				}
-				else if (helper.Num() > pybytes_len)
-				{
-					helper.RemoveValues(pybytes_len, helper.Num() - pybytes_len);
-				}
-
-
-				FMemory::Memcpy(helper.GetRawPtr(), buf, pybytes_len);
-
-				return true;
-			}
-		}
-
-		return false;
-	}
-
-	if (PyList_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UArrayProperty>(prop))
-		{
-			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
-
-			UProperty* array_prop = casted_prop->Inner;
-			Py_ssize_t pylist_len = PyList_Size(py_obj);
-
-			// fix array helper size
-			if (helper.Num() < pylist_len)
-			{
-				helper.AddValues(pylist_len - helper.Num());
-			}
-			else if (helper.Num() > pylist_len)
-			{
-				helper.RemoveValues(pylist_len, helper.Num() - pylist_len);
-			}
-
-			for (int i = 0; i < (int)pylist_len; i++)
-			{
-				PyObject* py_item = PyList_GetItem(py_obj, i);
-				if (!ue_py_convert_pyobject(py_item, array_prop, helper.GetRawPtr(i), 0))
-				{
-					return false;
-				}
-			}
-			return true;
-		}
-
-		return false;
-	}
-
-	if (PyTuple_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UArrayProperty>(prop))
-		{
-			FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
-
-			UProperty* array_prop = casted_prop->Inner;
-			Py_ssize_t pytuple_len = PyTuple_Size(py_obj);
-
-			// fix array helper size
-			if (helper.Num() < pytuple_len)
-			{
-				helper.AddValues(pytuple_len - helper.Num());
-			}
-			else if (helper.Num() > pytuple_len)
-			{
-				helper.RemoveValues(pytuple_len, helper.Num() - pytuple_len);
-			}
-
-			for (int i = 0; i < (int)pytuple_len; i++)
-			{
-				PyObject* py_item = PyTuple_GetItem(py_obj, i);
-				if (!ue_py_convert_pyobject(py_item, array_prop, helper.GetRawPtr(i), 0))
-				{
-					return false;
-				}
-			}
-			return true;
-		}
-
-		return false;
-	}
-
-#if ENGINE_MINOR_VERSION >= 15
-	if (PyDict_Check(py_obj))
-	{
-		if (auto casted_prop = Cast<UMapProperty>(prop))
-		{
-			FScriptMapHelper_InContainer map_helper(casted_prop, buffer, index);
-
-			PyObject* py_key = nullptr;
-			PyObject* py_value = nullptr;
-			Py_ssize_t pos = 0;
-
-			map_helper.EmptyValues();
-			while (PyDict_Next(py_obj, &pos, &py_key, &py_value))
-			{
-
-				int32 hindex = map_helper.AddDefaultValue_Invalid_NeedsRehash();
-				uint8* ptr = map_helper.GetPairPtr(hindex);
-
-				if (!ue_py_convert_pyobject(py_key, casted_prop->KeyProp, ptr, 0))
-				{
-					return false;
-				}
-
-				if (!ue_py_convert_pyobject(py_value, casted_prop->ValueProp, ptr, 0))
-				{
-					return false;
-				}
-			}
-			map_helper.Rehash();
-
-			return true;
-		}
-
-		return false;
-	}
-#endif
-
-	// structs
-
-	if (ue_PyFVector * py_vec = py_ue_is_fvector(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == TBaseStructure<FVector>::Get())
-			{
-				*casted_prop->ContainerPtrToValuePtr<FVector>(buffer, index) = py_vec->vec;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (ue_PyFVector2D * py_vec = py_ue_is_fvector2d(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == TBaseStructure<FVector2D>::Get())
-			{
-				*casted_prop->ContainerPtrToValuePtr<FVector2D>(buffer, index) = py_vec->vec;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (ue_PyFRotator * py_rot = py_ue_is_frotator(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == TBaseStructure<FRotator>::Get())
-			{
-				*casted_prop->ContainerPtrToValuePtr<FRotator>(buffer, index) = py_rot->rot;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (ue_PyFTransform * py_transform = py_ue_is_ftransform(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == TBaseStructure<FTransform>::Get())
-			{
-				*casted_prop->ContainerPtrToValuePtr<FTransform>(buffer, index) = py_transform->transform;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (ue_PyFColor * py_color = py_ue_is_fcolor(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == TBaseStructure<FColor>::Get())
-			{
-
-				*casted_prop->ContainerPtrToValuePtr<FColor>(buffer, index) = py_color->color;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (ue_PyFLinearColor * py_color = py_ue_is_flinearcolor(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == TBaseStructure<FLinearColor>::Get())
-			{
-				*casted_prop->ContainerPtrToValuePtr<FLinearColor>(buffer, index) = py_color->color;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (ue_PyFHitResult * py_hit = py_ue_is_fhitresult(py_obj))
-	{
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == FHitResult::StaticStruct())
-			{
-				*casted_prop->ContainerPtrToValuePtr<FHitResult>(buffer, index) = py_hit->hit;
-				return true;
-			}
-		}
-		return false;
-	}
-
-	// generic structs
-	if (py_ue_is_uscriptstruct(py_obj))
-	{
-		ue_PyUScriptStruct* py_u_struct = (ue_PyUScriptStruct*)py_obj;
-		if (auto casted_prop = Cast<UStructProperty>(prop))
-		{
-			if (casted_prop->Struct == py_u_struct->u_struct)
-			{
-				uint8* dest = casted_prop->ContainerPtrToValuePtr<uint8>(buffer, index);
-				py_u_struct->u_struct->InitializeStruct(dest);
-				py_u_struct->u_struct->CopyScriptStruct(dest, py_u_struct->u_struct_ptr);
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (PyObject_IsInstance(py_obj, (PyObject*)& ue_PyUObjectType))
-	{
-		ue_PyUObject* ue_obj = (ue_PyUObject*)py_obj;
-		if (ue_obj->ue_object->IsA<UClass>())
-		{
-			if (auto casted_prop = Cast<UClassProperty>(prop))
-			{
-				casted_prop->SetPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
-				return true;
-			}
-			else if (auto casted_prop_soft_class = Cast<USoftClassProperty>(prop))
-			{
-				casted_prop_soft_class->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
-				return true;
-			}
-			else if (auto casted_prop_soft_object = Cast<USoftObjectProperty>(prop))
-			{
-
-				casted_prop_soft_object->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
-
-				return true;
-			}
-			else if (auto casted_prop_weak_object = Cast<UWeakObjectProperty>(prop))
-			{
-
-				casted_prop_weak_object->SetPropertyValue_InContainer(buffer, FWeakObjectPtr(ue_obj->ue_object), index);
-
-				return true;
-			}
-			else if (auto casted_prop_base = Cast<UObjectPropertyBase>(prop))
-			{
-				// ensure the object type is correct, otherwise crash could happen (soon or later)
-				if (!ue_obj->ue_object->IsA(casted_prop_base->PropertyClass))
-					return false;
-
-				casted_prop_base->SetObjectPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
-
-				return true;
-			}
-
-			return false;
-		}
-
-
-		if (ue_obj->ue_object->IsA<UObject>())
-		{
-			if (auto casted_prop = Cast<UObjectPropertyBase>(prop))
-			{
-				// if the property specifies an interface, the object must be of a class that implements it
-				if (casted_prop->PropertyClass->HasAnyClassFlags(CLASS_Interface))
-				{
-					if (!ue_obj->ue_object->GetClass()->ImplementsInterface(casted_prop->PropertyClass))
-						return false;
-				}
-				else
-				{
-					// ensure the object type is correct, otherwise crash could happen (soon or later)
-					if (!ue_obj->ue_object->IsA(casted_prop->PropertyClass))
-						return false;
-				}
-
-				casted_prop->SetObjectPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
-
-				return true;
-			}
-			else if (auto casted_prop_soft_object = Cast<USoftObjectProperty>(prop))
-			{
-				if (!ue_obj->ue_object->IsA(casted_prop_soft_object->PropertyClass))
-					return false;
-
-				casted_prop_soft_object->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
-
-				return true;
-			}
-			else if (auto casted_prop_interface = Cast<UInterfaceProperty>(prop))
-			{
-				// ensure the object type is correct, otherwise crash could happen (soon or later)
-				if (!ue_obj->ue_object->GetClass()->ImplementsInterface(casted_prop_interface->InterfaceClass))
-					return false;
-
-				casted_prop_interface->SetPropertyValue_InContainer(buffer, FScriptInterface(ue_obj->ue_object), index);
-
-				return true;
-			}
-		}
-		return false;
-	}
-
-	if (py_obj == Py_None)
-	{
-		auto casted_prop_class = Cast<UClassProperty>(prop);
-		if (casted_prop_class)
-		{
-
-			casted_prop_class->SetPropertyValue_InContainer(buffer, nullptr, index);
-
-			return true;
-		}
-		auto casted_prop = Cast<UObjectPropertyBase>(prop);
-		if (casted_prop)
-		{
-
-			casted_prop->SetObjectPropertyValue_InContainer(buffer, nullptr, index);
-
-			return true;
-		}
-		return false;
-	}
-
-	return false;
-
-}
-
-
-// check if a python object is a wrapper to a UObject
-ue_PyUObject* ue_is_pyuobject(PyObject* obj)
-{
-	if (!PyObject_IsInstance(obj, (PyObject*)& ue_PyUObjectType))
-		return nullptr;
-	return (ue_PyUObject*)obj;
-}
-
-void ue_bind_events_for_py_class_by_attribute(UObject* u_obj, PyObject* py_class)
-{
-	// attempt to register events
-	PyObject* attrs = PyObject_Dir(py_class);
-	if (!attrs)
-		return;
-
-	AActor* actor = Cast<AActor>(u_obj);
-	if (!actor)
-	{
-		UActorComponent* component = Cast<UActorComponent>(u_obj);
-		if (!component)
-			return;
-		actor = component->GetOwner();
-	}
-
-	Py_ssize_t len = PyList_Size(attrs);
-	for (Py_ssize_t i = 0; i < len; i++)
-	{
-		PyObject* py_attr_name = PyList_GetItem(attrs, i);
-		if (!py_attr_name || !PyUnicodeOrString_Check(py_attr_name))
-			continue;
-		PyObject* item = PyObject_GetAttrString(py_class, UEPyUnicode_AsUTF8(py_attr_name));
-		if (item && PyCallable_Check(item))
-		{
-			// check for ue_event signature
-			PyObject* event_signature = PyObject_GetAttrString(item, (char*)"ue_event");
-			if (event_signature)
-			{
-				if (PyUnicodeOrString_Check(event_signature))
-				{
-					FString event_name = FString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(event_signature)));
-					TArray<FString> parts;
-					int n = event_name.ParseIntoArray(parts, UTF8_TO_TCHAR("."));
-					if (n < 1 || n > 2)
-					{
-						PyErr_SetString(PyExc_Exception, "invalid ue_event syntax, must be the name of an event or ComponentName.Event");
-						unreal_engine_py_log_error();
-					}
-					else
-					{
-						if (n == 1)
-						{
-							if (!ue_bind_pyevent(ue_get_python_uobject(actor), parts[0], item, true))
-							{
-								unreal_engine_py_log_error();
-							}
-						}
-						else
-						{
-							bool found = false;
-							for (UActorComponent* component : actor->GetComponents())
-							{
-								if (component->GetFName() == FName(*parts[0]))
-								{
-									if (!ue_bind_pyevent(ue_get_python_uobject(component), parts[1], item, true))
-									{
-										unreal_engine_py_log_error();
-									}
-									found = true;
-									break;
-								}
-							}
-
-							if (!found)
-							{
-								PyErr_SetString(PyExc_Exception, "unable to find component by name");
-								unreal_engine_py_log_error();
-							}
-						}
-					}
-				}
-				else
-				{
-					PyErr_SetString(PyExc_Exception, "ue_event attribute must be a string");
-					unreal_engine_py_log_error();
-				}
-			}
-			Py_XDECREF(event_signature);
-		}
-		Py_XDECREF(item);
-	}
-	Py_DECREF(attrs);
-
-	PyErr_Clear();
-}
-
-// automatically bind events based on class methods names
-void ue_autobind_events_for_pyclass(ue_PyUObject* u_obj, PyObject* py_class)
-{
-	PyObject* attrs = PyObject_Dir(py_class);
-	if (!attrs)
-		return;
+// automatically bind events based on class methods names
+void ue_autobind_events_for_pyclass(ue_PyUObject* u_obj, PyObject* py_class)
+{
+	PyObject* attrs = PyObject_Dir(py_class);
+	if (!attrs)
+		return;
 
 	Py_ssize_t len = PyList_Size(attrs);
 	for (Py_ssize_t i = 0; i < len; i++)
@@ -2876,17 +2363,6 @@ void ue_autobind_events_for_pyclass(ue_PyUObject* u_obj, PyObject* py_class)
 	Py_DECREF(attrs);
 }
 
-static void py_ue_destroy_params(UFunction* u_function, uint8* buffer)
-{
-	// destroy params
-	TFieldIterator<UProperty> DArgs(u_function);
-	for (; DArgs && (DArgs->PropertyFlags & CPF_Parm); ++DArgs)
-	{
-		UProperty* prop = *DArgs;
-		prop->DestroyValue_InContainer(buffer);
-	}
-}
-
 PyObject* py_ue_ufunction_call(UFunction* u_function, UObject* u_obj, PyObject* args, int argn, PyObject* kwargs)
 {
 
@@ -2904,86 +2380,56 @@ PyObject* py_ue_ufunction_call(UFunction* u_function, UObject* u_obj, PyObject*
 		}
 	}
 
-	//NOTE: u_function->PropertiesSize maps to local variable uproperties + ufunction paramaters uproperties
-	uint8* buffer = (uint8*)FMemory_Alloca(u_function->ParmsSize);
-	FMemory::Memzero(buffer, u_function->ParmsSize);
-	// initialize args
-	for (TFieldIterator<UProperty> IArgs(u_function); IArgs && IArgs->HasAnyPropertyFlags(CPF_Parm); ++IArgs)
+	FUnrealEnginePythonCallPlanCache* CallPlanCache = FUnrealEnginePythonCallPlanCache::Get();
+	FPyUFunctionCallPlan* plan = CallPlanCache->FindOrBuild(u_function);
+	if (!plan)
 	{
-		UProperty* prop = *IArgs;
-		if (!prop->HasAnyPropertyFlags(CPF_ZeroConstructor))
-		{
-			prop->InitializeValue_InContainer(buffer);
-		}
-
-		//UObject::CallFunctionByNameWithArguments() only does this part on non return value params
-		if ((IArgs->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm)
-		{
-			if (!prop->IsInContainer(u_function->ParmsSize))
-			{
-				return PyErr_Format(PyExc_Exception, "Attempting to import func param property that's out of bounds. %s", TCHAR_TO_UTF8(*u_function->GetName()));
-			}
-#if WITH_EDITOR
-			FString default_key = FString("CPP_Default_") + prop->GetName();
-			FString default_key_value = u_function->GetMetaData(FName(*default_key));
-			if (!default_key_value.IsEmpty())
-			{
-#if ENGINE_MINOR_VERSION >= 17
-				prop->ImportText(*default_key_value, prop->ContainerPtrToValuePtr<uint8>(buffer), PPF_None, NULL);
-#else
-				prop->ImportText(*default_key_value, prop->ContainerPtrToValuePtr<uint8>(buffer), PPF_Localized, NULL);
-#endif
-			}
-#endif
-		}
+		return nullptr;
 	}
 
+	uint8* buffer = (uint8*)FMemory_Alloca(u_function->ParmsSize);
+	// initialize args (defaults are already parsed in the plan)
+	plan->InitParms(buffer);
 
 	Py_ssize_t tuple_len = PyTuple_Size(args);
 
-	int has_out_params = 0;
-
-	TFieldIterator<UProperty> PArgs(u_function);
-	for (; PArgs && ((PArgs->PropertyFlags & (CPF_Parm | CPF_ReturnParm)) == CPF_Parm); ++PArgs)
+	for (const FPyUFunctionParam& param : plan->InputParams)
 	{
-		UProperty* prop = *PArgs;
 		if (argn < tuple_len)
 		{
 			PyObject* py_arg = PyTuple_GetItem(args, argn);
 			if (!py_arg)
 			{
-				py_ue_destroy_params(u_function, buffer);
-				return PyErr_Format(PyExc_TypeError, "unable to get pyobject for property %s", TCHAR_TO_UTF8(*prop->GetName()));
+				plan->DestroyParms(buffer);
+				return PyErr_Format(PyExc_TypeError, "unable to get pyobject for property %s", TCHAR_TO_UTF8(*param.Property->GetName()));
 			}
-			if (!ue_py_convert_pyobject(py_arg, prop, buffer, 0))
+			if (!param.ToProperty(py_arg, param.Property, buffer, 0))
 			{
-				py_ue_destroy_params(u_function, buffer);
-				return PyErr_Format(PyExc_TypeError, "unable to convert pyobject to property %s (%s)", TCHAR_TO_UTF8(*prop->GetName()), TCHAR_TO_UTF8(*prop->GetClass()->GetName()));
+				plan->DestroyParms(buffer);
+				return PyErr_Format(PyExc_TypeError, "unable to convert pyobject to property %s (%s)", TCHAR_TO_UTF8(*param.Property->GetName()), TCHAR_TO_UTF8(*param.Property->GetClass()->GetName()));
 			}
 		}
-		else if (kwargs)
+		else if (kwargs && param.PyName)
 		{
-			char* prop_name = TCHAR_TO_UTF8(*prop->GetName());
-			PyObject* dict_value = PyDict_GetItemString(kwargs, prop_name);
+			PyObject* dict_value = PyDict_GetItem(kwargs, param.PyName);
 			if (dict_value)
 			{
-				if (!ue_py_convert_pyobject(dict_value, prop, buffer, 0))
+				if (!param.ToProperty(dict_value, param.Property, buffer, 0))
 				{
-					py_ue_destroy_params(u_function, buffer);
-					return PyErr_Format(PyExc_TypeError, "unable to convert pyobject to property %s (%s)", TCHAR_TO_UTF8(*prop->GetName()), TCHAR_TO_UTF8(*prop->GetClass()->GetName()));
+					plan->DestroyParms(buffer);
+					return PyErr_Format(PyExc_TypeError, "unable to convert pyobject to property %s (%s)", TCHAR_TO_UTF8(*param.Property->GetName()), TCHAR_TO_UTF8(*param.Property->GetClass()->GetName()));
 				}
 			}
 		}
-		if (prop->HasAnyPropertyFlags(CPF_OutParm) && (prop->IsA<UArrayProperty>() || prop->HasAnyPropertyFlags(CPF_ConstParm) == false))
-		{
-			has_out_params++;
-		}
 		argn++;
 	}
 
 	FScopeCycleCounterUObject ObjectScope(u_obj);
 	FScopeCycleCounterUObject FunctionScope(u_function);
 
+	// ProcessEvent could reenter python and invalidate the plans cache
+	CallPlanCache->BeginCall();
+
 	Py_BEGIN_ALLOW_THREADS;
 	u_obj->ProcessEvent(u_function, buffer);
 	Py_END_ALLOW_THREADS;
@@ -2991,59 +2437,49 @@ PyObject* py_ue_ufunction_call(UFunction* u_function, UObject* u_obj, PyObject*
 	PyObject* ret = nullptr;
 
 	int has_ret_param = 0;
-	TFieldIterator<UProperty> Props(u_function);
-	for (; Props; ++Props)
+	if (plan->bHasReturnParam)
 	{
-		UProperty* prop = *Props;
-		if (prop->GetPropertyFlags() & CPF_ReturnParm)
+		ret = plan->ReturnParam.ToPython(plan->ReturnParam.Property, buffer, 0);
+		if (!ret)
 		{
-			ret = ue_py_convert_property(prop, buffer, 0);
-			if (!ret)
-			{
-				// destroy params
-				py_ue_destroy_params(u_function, buffer);
-				return NULL;
-			}
-			has_ret_param = 1;
-			break;
+			// destroy params
+			plan->DestroyParms(buffer);
+			CallPlanCache->EndCall();
+			return NULL;
 		}
+		has_ret_param = 1;
 	}
 
-	if (has_out_params > 0)
+	if (plan->OutParams.Num() > 0)
 	{
-		PyObject* multi_ret = PyTuple_New(has_out_params + has_ret_param);
+		PyObject* multi_ret = PyTuple_New(plan->OutParams.Num() + has_ret_param);
 		if (ret)
 		{
 			PyTuple_SetItem(multi_ret, 0, ret);
 		}
-		TFieldIterator<UProperty> OProps(u_function);
-		for (; OProps; ++OProps)
+		for (const FPyUFunctionParam& param : plan->OutParams)
 		{
-			UProperty* prop = *OProps;
-			if (prop->HasAnyPropertyFlags(CPF_OutParm) && (prop->IsA<UArrayProperty>() || prop->HasAnyPropertyFlags(CPF_ConstParm) == false))
+			PyObject* py_out = param.ToPython(param.Property, buffer, 0);
+			if (!py_out)
 			{
-				// skip return param as it must be always the first
-				if (prop->GetPropertyFlags() & CPF_ReturnParm)
-					continue;
-				PyObject* py_out = ue_py_convert_property(prop, buffer, 0);
-				if (!py_out)
-				{
-					Py_DECREF(multi_ret);
-					// destroy params
-					py_ue_destroy_params(u_function, buffer);
-					return NULL;
-				}
-				PyTuple_SetItem(multi_ret, has_ret_param, py_out);
-				has_ret_param++;
+				Py_DECREF(multi_ret);
+				// destroy params
+				plan->DestroyParms(buffer);
+				CallPlanCache->EndCall();
+				return NULL;
 			}
+			PyTuple_SetItem(multi_ret, has_ret_param, py_out);
+			has_ret_param++;
 		}
 		// destroy params
-		py_ue_destroy_params(u_function, buffer);
+		plan->DestroyParms(buffer);
+		CallPlanCache->EndCall();
 		return multi_ret;
 	}
 
 	// destroy params
-	py_ue_destroy_params(u_function, buffer);
+	plan->DestroyParms(buffer);
+	CallPlanCache->EndCall();
 
 	if (ret)
 		return ret;
@@ -3642,6 +3078,9 @@ UFunction* unreal_engine_add_function(UClass* u_class, char* name, PyObject* py_
 	}
 #endif
 
+	// subclasses of u_class can now resolve the new function too
+	FUnrealEnginePythonAttributeCache::Get()->Invalidate();
+
 	return function;
 }
 
@@ -0,0 +1,839 @@
+#include "UEPyPropertyConverters.h"
+
+#include "Wrappers/UEPyFVector2D.h"
+#include "Wrappers/UEPyFHitResult.h"
+#include "Wrappers/UEPyFArrayPropertyView.h"
+
+#if ENGINE_MINOR_VERSION < 18
+#define USoftObjectProperty UAssetObjectProperty
+#define USoftClassProperty UAssetClassProperty
+typedef FAssetPtr FSoftObjectPtr;
+#endif
+
+static TMap<UClass *, FPyPropertyConverter> ClassConverters;
+static TMap<UScriptStruct *, FPyPropertyConverter> StructConverters;
+static FPyPropertyConverter GenericStructConverter;
+static FPyPropertyConverter UnsupportedConverter;
+
+// python -> property helpers
+
+template<typename T> static void ue_py_array_resize(T &helper, Py_ssize_t len)
+{
+	// fix array helper size
+	if (helper.Num() < len)
+	{
+		helper.AddValues(len - helper.Num());
+	}
+	else if (helper.Num() > len)
+	{
+		helper.RemoveValues(len, helper.Num() - len);
+	}
+}
+
+// like bytearray, arrays whose memory is exported to python cannot be resized
+static bool ue_py_array_check_resize(UArrayProperty *casted_prop, uint8 *buffer, int32 index, Py_ssize_t len)
+{
+	FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
+	if (helper.Num() == len || !py_ue_farray_is_exported(casted_prop->ContainerPtrToValuePtr<void>(buffer, index)))
+		return true;
+	PyErr_SetString(PyExc_BufferError, "Existing exports of data: object cannot be re-sized");
+	return false;
+}
+
+// bool
+
+static PyObject *ue_py_bool_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	bool value = ((UBoolProperty *)prop)->GetPropertyValue_InContainer(buffer, index);
+	if (value)
+	{
+		Py_RETURN_TRUE;
+	}
+	Py_RETURN_FALSE;
+}
+
+static bool ue_py_pyobject_to_bool(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (!PyBool_Check(py_obj))
+		return false;
+	((UBoolProperty *)prop)->SetPropertyValue_InContainer(buffer, PyObject_IsTrue(py_obj) ? true : false, index);
+	return true;
+}
+
+// numbers
+
+static PyObject *ue_py_int_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyLong_FromLong(((UIntProperty *)prop)->GetPropertyValue_InContainer(buffer, index));
+}
+
+static PyObject *ue_py_uint32_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyLong_FromUnsignedLong(((UUInt32Property *)prop)->GetPropertyValue_InContainer(buffer, index));
+}
+
+static PyObject *ue_py_int64_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyLong_FromLongLong(((UInt64Property *)prop)->GetPropertyValue_InContainer(buffer, index));
+}
+
+static PyObject *ue_py_uint64_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyLong_FromUnsignedLongLong(((UUInt64Property *)prop)->GetPropertyValue_InContainer(buffer, index));
+}
+
+static PyObject *ue_py_float_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyFloat_FromDouble(((UFloatProperty *)prop)->GetPropertyValue_InContainer(buffer, index));
+}
+
+static PyObject *ue_py_byte_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyLong_FromUnsignedLong(((UByteProperty *)prop)->GetPropertyValue_InContainer(buffer, index));
+}
+
+// bool is a number subclass, but it can only be assigned to UBoolProperty
+// on failure no python error is left set (the caller reports the conversion error)
+static PyObject *ue_py_number_as_long(PyObject *py_obj)
+{
+	if (PyBool_Check(py_obj) || !PyNumber_Check(py_obj))
+		return nullptr;
+	PyObject *py_long = PyNumber_Long(py_obj);
+	if (!py_long)
+		PyErr_Clear();
+	return py_long;
+}
+
+// PyLong_As* functions set OverflowError for out of range values, they are conversion failures
+static bool ue_py_long_overflowed(PyObject *py_long)
+{
+	Py_DECREF(py_long);
+	if (PyErr_Occurred())
+	{
+		PyErr_Clear();
+		return true;
+	}
+	return false;
+}
+
+static bool ue_py_pyobject_to_int(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	PyObject *py_long = ue_py_number_as_long(py_obj);
+	if (!py_long)
+		return false;
+	long value = PyLong_AsLong(py_long);
+	if (ue_py_long_overflowed(py_long))
+		return false;
+	((UIntProperty *)prop)->SetPropertyValue_InContainer(buffer, value, index);
+	return true;
+}
+
+static bool ue_py_pyobject_to_uint32(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	PyObject *py_long = ue_py_number_as_long(py_obj);
+	if (!py_long)
+		return false;
+	unsigned long value = PyLong_AsUnsignedLong(py_long);
+	if (ue_py_long_overflowed(py_long))
+		return false;
+	((UUInt32Property *)prop)->SetPropertyValue_InContainer(buffer, value, index);
+	return true;
+}
+
+static bool ue_py_pyobject_to_int64(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	PyObject *py_long = ue_py_number_as_long(py_obj);
+	if (!py_long)
+		return false;
+	long long value = PyLong_AsLongLong(py_long);
+	if (ue_py_long_overflowed(py_long))
+		return false;
+	((UInt64Property *)prop)->SetPropertyValue_InContainer(buffer, value, index);
+	return true;
+}
+
+static bool ue_py_pyobject_to_uint64(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	PyObject *py_long = ue_py_number_as_long(py_obj);
+	if (!py_long)
+		return false;
+	unsigned long long value = PyLong_AsUnsignedLongLong(py_long);
+	if (ue_py_long_overflowed(py_long))
+		return false;
+	((UUInt64Property *)prop)->SetPropertyValue_InContainer(buffer, value, index);
+	return true;
+}
+
+static bool ue_py_pyobject_to_float(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (PyBool_Check(py_obj) || !PyNumber_Check(py_obj))
+		return false;
+	PyObject *py_float = PyNumber_Float(py_obj);
+	if (!py_float)
+	{
+		PyErr_Clear();
+		return false;
+	}
+	((UFloatProperty *)prop)->SetPropertyValue_InContainer(buffer, PyFloat_AsDouble(py_float), index);
+	Py_DECREF(py_float);
+	return true;
+}
+
+static bool ue_py_pyobject_to_byte(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	PyObject *py_long = ue_py_number_as_long(py_obj);
+	if (!py_long)
+		return false;
+	unsigned long value = PyLong_AsUnsignedLong(py_long);
+	if (ue_py_long_overflowed(py_long))
+		return false;
+	((UByteProperty *)prop)->SetPropertyValue_InContainer(buffer, value, index);
+	return true;
+}
+
+#if ENGINE_MINOR_VERSION >= 15
+static PyObject *ue_py_enum_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	UEnumProperty *casted_prop = (UEnumProperty *)prop;
+	void *prop_addr = casted_prop->ContainerPtrToValuePtr<void>(buffer, index);
+	uint64 enum_index = casted_prop->GetUnderlyingProperty()->GetUnsignedIntPropertyValue(prop_addr);
+	return PyLong_FromUnsignedLong(enum_index);
+}
+
+static bool ue_py_pyobject_to_enum(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	PyObject *py_long = ue_py_number_as_long(py_obj);
+	if (!py_long)
+		return false;
+	unsigned long value = PyLong_AsUnsignedLong(py_long);
+	if (ue_py_long_overflowed(py_long))
+		return false;
+	UEnumProperty *casted_prop = (UEnumProperty *)prop;
+	void *prop_addr = casted_prop->ContainerPtrToValuePtr<void>(buffer, index);
+	casted_prop->GetUnderlyingProperty()->SetIntPropertyValue(prop_addr, (uint64)value);
+	return true;
+}
+#endif
+
+// strings
+
+static PyObject *ue_py_str_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	FString value = ((UStrProperty *)prop)->GetPropertyValue_InContainer(buffer, index);
+	return PyUnicode_FromString(TCHAR_TO_UTF8(*value));
+}
+
+static PyObject *ue_py_text_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	FText value = ((UTextProperty *)prop)->GetPropertyValue_InContainer(buffer, index);
+	return PyUnicode_FromString(TCHAR_TO_UTF8(*value.ToString()));
+}
+
+static PyObject *ue_py_name_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	FName value = ((UNameProperty *)prop)->GetPropertyValue_InContainer(buffer, index);
+	return PyUnicode_FromString(TCHAR_TO_UTF8(*value.ToString()));
+}
+
+static bool ue_py_pyobject_to_str(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (!PyUnicodeOrString_Check(py_obj))
+		return false;
+	((UStrProperty *)prop)->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
+	return true;
+}
+
+static bool ue_py_pyobject_to_text(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (!PyUnicodeOrString_Check(py_obj))
+		return false;
+	((UTextProperty *)prop)->SetPropertyValue_InContainer(buffer, FText::FromString(UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj))), index);
+	return true;
+}
+
+static bool ue_py_pyobject_to_name(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (!PyUnicodeOrString_Check(py_obj))
+		return false;
+	((UNameProperty *)prop)->SetPropertyValue_InContainer(buffer, UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_obj)), index);
+	return true;
+}
+
+// objects
+
+static PyObject *ue_py_object_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	// this includes class, soft, weak and lazy properties
+	auto value = ((UObjectPropertyBase *)prop)->GetObjectPropertyValue_InContainer(buffer, index);
+	if (value)
+	{
+		Py_RETURN_UOBJECT(value);
+	}
+	Py_RETURN_NONE;
+}
+
+static bool ue_py_pyobject_to_object(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (py_obj == Py_None)
+	{
+		auto casted_prop_class = Cast<UClassProperty>(prop);
+		if (casted_prop_class)
+		{
+			casted_prop_class->SetPropertyValue_InContainer(buffer, nullptr, index);
+			return true;
+		}
+		auto casted_prop = Cast<UObjectPropertyBase>(prop);
+		if (casted_prop)
+		{
+			casted_prop->SetObjectPropertyValue_InContainer(buffer, nullptr, index);
+			return true;
+		}
+		return false;
+	}
+
+	ue_PyUObject *ue_obj = ue_is_pyuobject(py_obj);
+	if (!ue_obj)
+		return false;
+
+	if (ue_obj->ue_object->IsA<UClass>())
+	{
+		if (auto casted_prop = Cast<UClassProperty>(prop))
+		{
+			casted_prop->SetPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
+			return true;
+		}
+		else if (auto casted_prop_soft_class = Cast<USoftClassProperty>(prop))
+		{
+			casted_prop_soft_class->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
+			return true;
+		}
+		else if (auto casted_prop_soft_object = Cast<USoftObjectProperty>(prop))
+		{
+			casted_prop_soft_object->SetPropertyValue_InContainer(buffer, FSoftObjectPtr(ue_obj->ue_object), index);
+			return true;
+		}
+		else if (auto casted_prop_weak_object = Cast<UWeakObjectProperty>(prop))
+		{
+			casted_prop_weak_object->SetPropertyValue_InContainer(buffer, FWeakObjectPtr(ue_obj->ue_object), index);
+			return true;
+		}
+		else if (auto casted_prop_base = Cast<UObjectPropertyBase>(prop))
+		{
+			// ensure the object type is correct, otherwise crash could happen (soon or later)
+			if (!ue_obj->ue_object->IsA(casted_prop_base->PropertyClass))
+				return false;
+
+			casted_prop_base->SetObjectPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
+			return true;
+		}
+
+		return false;
+	}
+
+	if (auto casted_prop = Cast<UObjectPropertyBase>(prop))
+	{
+		// if the property specifies an interface, the object must be of a class that implements it
+		if (casted_prop->PropertyClass->HasAnyClassFlags(CLASS_Interface))
+		{
+			if (!ue_obj->ue_object->GetClass()->ImplementsInterface(casted_prop->PropertyClass))
+				return false;
+		}
+		else
+		{
+			// ensure the object type is correct, otherwise crash could happen (soon or later)
+			if (!ue_obj->ue_object->IsA(casted_prop->PropertyClass))
+				return false;
+		}
+
+		casted_prop->SetObjectPropertyValue_InContainer(buffer, ue_obj->ue_object, index);
+		return true;
+	}
+	else if (auto casted_prop_interface = Cast<UInterfaceProperty>(prop))
+	{
+		// ensure the object type is correct, otherwise crash could happen (soon or later)
+		if (!ue_obj->ue_object->GetClass()->ImplementsInterface(casted_prop_interface->InterfaceClass))
+			return false;
+
+		casted_prop_interface->SetPropertyValue_InContainer(buffer, FScriptInterface(ue_obj->ue_object), index);
+		return true;
+	}
+
+	return false;
+}
+
+// delegates are exposed as their UProperty
+static PyObject *ue_py_delegate_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	Py_RETURN_UOBJECT(prop);
+}
+
+// structs
+
+static PyObject *ue_py_struct_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	UStructProperty *casted_prop = (UStructProperty *)prop;
+	if (auto casted_struct = Cast<UScriptStruct>(casted_prop->Struct))
+	{
+		return py_ue_new_uscriptstruct(casted_struct, casted_prop->ContainerPtrToValuePtr<uint8>(buffer, index));
+	}
+	return PyErr_Format(PyExc_TypeError, "unsupported UStruct type");
+}
+
+static bool ue_py_pyobject_to_struct(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	ue_PyUScriptStruct *py_u_struct = py_ue_is_uscriptstruct(py_obj);
+	if (!py_u_struct)
+		return false;
+	UStructProperty *casted_prop = (UStructProperty *)prop;
+	if (casted_prop->Struct != py_u_struct->u_struct)
+		return false;
+	uint8 *dest = casted_prop->ContainerPtrToValuePtr<uint8>(buffer, index);
+	py_u_struct->u_struct->InitializeStruct(dest);
+	py_u_struct->u_struct->CopyScriptStruct(dest, py_u_struct->u_struct_ptr);
+	return true;
+}
+
+// structs with a dedicated python wrapper (generic UScriptStruct wrappers are still accepted)
+#define UEPY_WRAPPED_STRUCT_CONVERTER(name, type, wrapper, field, check_func, new_func) \
+static PyObject *ue_py_##name##_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)\
+{\
+	return new_func(*((UStructProperty *)prop)->ContainerPtrToValuePtr<type>(buffer, index));\
+}\
+static bool ue_py_pyobject_to_##name(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)\
+{\
+	if (wrapper *py_wrapper = check_func(py_obj))\
+	{\
+		*((UStructProperty *)prop)->ContainerPtrToValuePtr<type>(buffer, index) = py_wrapper->field;\
+		return true;\
+	}\
+	return ue_py_pyobject_to_struct(py_obj, prop, buffer, index);\
+}
+
+UEPY_WRAPPED_STRUCT_CONVERTER(fvector, FVector, ue_PyFVector, vec, py_ue_is_fvector, py_ue_new_fvector)
+UEPY_WRAPPED_STRUCT_CONVERTER(fvector2d, FVector2D, ue_PyFVector2D, vec, py_ue_is_fvector2d, py_ue_new_fvector2d)
+UEPY_WRAPPED_STRUCT_CONVERTER(frotator, FRotator, ue_PyFRotator, rot, py_ue_is_frotator, py_ue_new_frotator)
+UEPY_WRAPPED_STRUCT_CONVERTER(ftransform, FTransform, ue_PyFTransform, transform, py_ue_is_ftransform, py_ue_new_ftransform)
+UEPY_WRAPPED_STRUCT_CONVERTER(fhitresult, FHitResult, ue_PyFHitResult, hit, py_ue_is_fhitresult, py_ue_new_fhitresult)
+UEPY_WRAPPED_STRUCT_CONVERTER(fcolor, FColor, ue_PyFColor, color, py_ue_is_fcolor, py_ue_new_fcolor)
+UEPY_WRAPPED_STRUCT_CONVERTER(flinearcolor, FLinearColor, ue_PyFLinearColor, color, py_ue_is_flinearcolor, py_ue_new_flinearcolor)
+
+// containers
+
+static PyObject *ue_py_array_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	UArrayProperty *casted_prop = (UArrayProperty *)prop;
+	FScriptArrayHelper_InContainer array_helper(casted_prop, buffer, index);
+
+	UProperty *array_prop = casted_prop->Inner;
+
+	// check for TArray<uint8>, so we can use bytearray optimization
+	if (auto uint8_tarray = Cast<UByteProperty>(array_prop))
+	{
+		uint8 *buf = array_helper.GetRawPtr();
+		return PyByteArray_FromStringAndSize((char *)buf, array_helper.Num());
+	}
+
+	ue_py_property_to_pyobject inner_to_python = ue_py_get_property_converter(array_prop).ToPython;
+
+	PyObject *py_list = PyList_New(array_helper.Num());
+
+	for (int i = 0; i < array_helper.Num(); i++)
+	{
+		PyObject *item = inner_to_python(array_prop, array_helper.GetRawPtr(i), 0);
+		if (!item)
+		{
+			Py_DECREF(py_list);
+			return NULL;
+		}
+		PyList_SET_ITEM(py_list, i, item);
+	}
+
+	return py_list;
+}
+
+static bool ue_py_raw_bytes_to_array(UArrayProperty *casted_prop, uint8 *buffer, int32 index, uint8 *buf, Py_ssize_t len)
+{
+	if (!Cast<UByteProperty>(casted_prop->Inner))
+		return false;
+
+	if (!ue_py_array_check_resize(casted_prop, buffer, index, len))
+		return false;
+
+	FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
+	ue_py_array_resize(helper, len);
+	FMemory::Memcpy(helper.GetRawPtr(), buf, len);
+	return true;
+}
+
+// 0 for unknown formats, 'i' for signed integers, 'u' for unsigned ones, 'f' for floating point
+static char ue_py_buffer_format_kind(const char *format)
+{
+	// native and little endian byte orders match the engine memory
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+	// only single scalars are supported
+	if (format[0] == 0 || format[1] != 0)
+		return 0;
+	if (strchr("bhilq", format[0]))
+		return 'i';
+	if (strchr("BHILQ", format[0]))
+		return 'u';
+	if (strchr("fd", format[0]))
+		return 'f';
+	return 0;
+}
+
+enum class EPyBufferToArray : uint8
+{
+	Copied,
+	Failed,
+	// the formats do not match, use per-item conversion
+	Mismatch,
+};
+
+static EPyBufferToArray ue_py_buffer_to_array(Py_buffer *view, UArrayProperty *casted_prop, uint8 *buffer, int32 index)
+{
+	FPyArrayItemFormat item_format;
+	if (!py_ue_get_array_item_format(casted_prop->Inner, item_format))
+		return EPyBufferToArray::Mismatch;
+
+	const char *format = view->format ? view->format : "B";
+	char kind = ue_py_buffer_format_kind(format);
+	if (kind == 0 || kind != ue_py_buffer_format_kind(item_format.Format))
+		return EPyBufferToArray::Mismatch;
+
+	if (!PyBuffer_IsContiguous(view, 'C'))
+		return EPyBufferToArray::Mismatch;
+
+	int32 components = FMath::Max(item_format.Components, 1);
+	// numpy shapes like (len, 3) for FVector, flat buffers are accepted too
+	if (view->ndim > 1 && view->shape[view->ndim - 1] != components)
+		return EPyBufferToArray::Mismatch;
+
+	if (view->itemsize <= 0 || (view->len / view->itemsize) % components != 0)
+		return EPyBufferToArray::Mismatch;
+
+	Py_ssize_t scalars = view->len / view->itemsize;
+	Py_ssize_t len = scalars / components;
+
+	if (!ue_py_array_check_resize(casted_prop, buffer, index, len))
+		return EPyBufferToArray::Failed;
+
+	const uint8 *src_buf = (const uint8 *)view->buf;
+	// the source could be a view of the same array: resizing could reallocate (or free) it, so it is copied before
+	TArray<uint8> aliased;
+	{
+		FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
+		if (helper.Num() > 0)
+		{
+			const uint8 *array_begin = helper.GetRawPtr();
+			const uint8 *array_end = array_begin + (int64)helper.Num() * casted_prop->Inner->ElementSize;
+			if (src_buf < array_end && src_buf + view->len > array_begin)
+			{
+				aliased.Append(src_buf, view->len);
+				src_buf = aliased.GetData();
+			}
+		}
+	}
+
+	if (view->itemsize == item_format.ItemSize)
+	{
+		FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
+		ue_py_array_resize(helper, len);
+		if (len > 0)
+		{
+			FMemory::Memcpy(helper.GetRawPtr(), src_buf, view->len);
+		}
+		return EPyBufferToArray::Copied;
+	}
+
+	// numpy defaults to float64, avoid the per-item path for float arrays
+	if (kind == 'f')
+	{
+		FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
+		ue_py_array_resize(helper, len);
+		if (len == 0)
+			return EPyBufferToArray::Copied;
+		if (view->itemsize == sizeof(double) && item_format.ItemSize == sizeof(float))
+		{
+			float *dest = (float *)helper.GetRawPtr();
+			const double *src = (const double *)src_buf;
+			for (Py_ssize_t i = 0; i < scalars; i++)
+				dest[i] = (float)src[i];
+			return EPyBufferToArray::Copied;
+		}
+		if (view->itemsize == sizeof(float) && item_format.ItemSize == sizeof(double))
+		{
+			double *dest = (double *)helper.GetRawPtr();
+			const float *src = (const float *)src_buf;
+			for (Py_ssize_t i = 0; i < scalars; i++)
+				dest[i] = src[i];
+			return EPyBufferToArray::Copied;
+		}
+		return EPyBufferToArray::Failed;
+	}
+
+	return EPyBufferToArray::Mismatch;
+}
+
+static bool ue_py_sequence_to_array(PyObject *py_fast, UArrayProperty *casted_prop, uint8 *buffer, int32 index)
+{
+	FScriptArrayHelper_InContainer helper(casted_prop, buffer, index);
+
+	UProperty *array_prop = casted_prop->Inner;
+	ue_py_pyobject_to_property inner_to_property = ue_py_get_property_converter(array_prop).ToProperty;
+
+	Py_ssize_t py_len = PySequence_Fast_GET_SIZE(py_fast);
+	PyObject **py_items = PySequence_Fast_ITEMS(py_fast);
+
+	if (!ue_py_array_check_resize(casted_prop, buffer, index, py_len))
+		return false;
+
+	ue_py_array_resize(helper, py_len);
+
+	for (int i = 0; i < (int)py_len; i++)
+	{
+		if (!inner_to_property(py_items[i], array_prop, helper.GetRawPtr(i), 0))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+static bool ue_py_pyobject_to_array(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	UArrayProperty *casted_prop = (UArrayProperty *)prop;
+
+	if (PyUnicodeOrString_Check(py_obj))
+		return false;
+
+	if (PyBytes_Check(py_obj))
+	{
+		return ue_py_raw_bytes_to_array(casted_prop, buffer, index, (uint8 *)PyBytes_AsString(py_obj), PyBytes_Size(py_obj));
+	}
+
+	if (PyByteArray_Check(py_obj))
+	{
+		return ue_py_raw_bytes_to_array(casted_prop, buffer, index, (uint8 *)PyByteArray_AsString(py_obj), PyByteArray_Size(py_obj));
+	}
+
+	if (PyList_Check(py_obj) || PyTuple_Check(py_obj))
+	{
+		return ue_py_sequence_to_array(py_obj, casted_prop, buffer, index);
+	}
+
+	// numpy arrays, memoryviews, array.array...
+	if (PyObject_CheckBuffer(py_obj))
+	{
+		Py_buffer view;
+		if (PyObject_GetBuffer(py_obj, &view, PyBUF_RECORDS_RO) < 0)
+		{
+			PyErr_Clear();
+			return false;
+		}
+		EPyBufferToArray result = ue_py_buffer_to_array(&view, casted_prop, buffer, index);
+		PyBuffer_Release(&view);
+
+		if (result != EPyBufferToArray::Mismatch)
+			return result == EPyBufferToArray::Copied;
+
+		PyObject *py_fast = PySequence_Fast(py_obj, "object is not iterable");
+		if (!py_fast)
+		{
+			PyErr_Clear();
+			return false;
+		}
+		bool success = ue_py_sequence_to_array(py_fast, casted_prop, buffer, index);
+		Py_DECREF(py_fast);
+		return success;
+	}
+
+	return false;
+}
+
+#if ENGINE_MINOR_VERSION >= 15
+static PyObject *ue_py_map_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	UMapProperty *casted_prop = (UMapProperty *)prop;
+	FScriptMapHelper_InContainer map_helper(casted_prop, buffer, index);
+
+	ue_py_property_to_pyobject key_to_python = ue_py_get_property_converter(map_helper.KeyProp).ToPython;
+	ue_py_property_to_pyobject value_to_python = ue_py_get_property_converter(map_helper.ValueProp).ToPython;
+
+	PyObject *py_dict = PyDict_New();
+
+	for (int32 i = 0; i < map_helper.Num(); i++)
+	{
+		if (map_helper.IsValidIndex(i))
+		{
+
+			uint8 *ptr = map_helper.GetPairPtr(i);
+
+			PyObject *py_key = key_to_python(map_helper.KeyProp, ptr, 0);
+			if (!py_key)
+			{
+				Py_DECREF(py_dict);
+				return NULL;
+			}
+
+			PyObject *py_value = value_to_python(map_helper.ValueProp, ptr, 0);
+			if (!py_value)
+			{
+				Py_DECREF(py_key);
+				Py_DECREF(py_dict);
+				return NULL;
+			}
+
+			PyDict_SetItem(py_dict, py_key, py_value);
+			Py_DECREF(py_key);
+			Py_DECREF(py_value);
+		}
+	}
+
+	return py_dict;
+}
+
+static bool ue_py_pyobject_to_map(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	if (!PyDict_Check(py_obj))
+		return false;
+
+	UMapProperty *casted_prop = (UMapProperty *)prop;
+	FScriptMapHelper_InContainer map_helper(casted_prop, buffer, index);
+
+	ue_py_pyobject_to_property key_to_property = ue_py_get_property_converter(casted_prop->KeyProp).ToProperty;
+	ue_py_pyobject_to_property value_to_property = ue_py_get_property_converter(casted_prop->ValueProp).ToProperty;
+
+	PyObject *py_key = nullptr;
+	PyObject *py_value = nullptr;
+	Py_ssize_t pos = 0;
+
+	map_helper.EmptyValues();
+	while (PyDict_Next(py_obj, &pos, &py_key, &py_value))
+	{
+
+		int32 hindex = map_helper.AddDefaultValue_Invalid_NeedsRehash();
+		uint8 *ptr = map_helper.GetPairPtr(hindex);
+
+		if (!key_to_property(py_key, casted_prop->KeyProp, ptr, 0))
+		{
+			return false;
+		}
+
+		if (!value_to_property(py_value, casted_prop->ValueProp, ptr, 0))
+		{
+			return false;
+		}
+	}
+	map_helper.Rehash();
+
+	return true;
+}
+#endif
+
+// fallbacks
+
+static PyObject *ue_py_unsupported_to_pyobject(UProperty *prop, uint8 *buffer, int32 index)
+{
+	return PyErr_Format(PyExc_Exception, "unsupported value type %s for property %s", TCHAR_TO_UTF8(*prop->GetClass()->GetName()), TCHAR_TO_UTF8(*prop->GetName()));
+}
+
+static bool ue_py_pyobject_to_unsupported(PyObject *py_obj, UProperty *prop, uint8 *buffer, int32 index)
+{
+	return false;
+}
+
+static void ue_py_register_converter(UClass *u_class, ue_py_property_to_pyobject to_python, ue_py_pyobject_to_property to_property)
+{
+	FPyPropertyConverter Converter;
+	Converter.ToPython = to_python;
+	Converter.ToProperty = to_property;
+	ClassConverters.Add(u_class, Converter);
+}
+
+static void ue_py_register_struct_converter(UScriptStruct *u_struct, ue_py_property_to_pyobject to_python, ue_py_pyobject_to_property to_property)
+{
+	FPyPropertyConverter Converter;
+	Converter.ToPython = to_python;
+	Converter.ToProperty = to_property;
+	StructConverters.Add(u_struct, Converter);
+}
+
+static void ue_py_init_property_converters()
+{
+	static bool bInitialized = false;
+	if (bInitialized)
+		return;
+	bInitialized = true;
+
+	UnsupportedConverter.ToPython = ue_py_unsupported_to_pyobject;
+	UnsupportedConverter.ToProperty = ue_py_pyobject_to_unsupported;
+
+	GenericStructConverter.ToPython = ue_py_struct_to_pyobject;
+	GenericStructConverter.ToProperty = ue_py_pyobject_to_struct;
+
+	// subclasses of the registered classes get the converter of their nearest registered ancestor
+	ue_py_register_converter(UBoolProperty::StaticClass(), ue_py_bool_to_pyobject, ue_py_pyobject_to_bool);
+	ue_py_register_converter(UIntProperty::StaticClass(), ue_py_int_to_pyobject, ue_py_pyobject_to_int);
+	ue_py_register_converter(UUInt32Property::StaticClass(), ue_py_uint32_to_pyobject, ue_py_pyobject_to_uint32);
+	ue_py_register_converter(UInt64Property::StaticClass(), ue_py_int64_to_pyobject, ue_py_pyobject_to_int64);
+	ue_py_register_converter(UUInt64Property::StaticClass(), ue_py_uint64_to_pyobject, ue_py_pyobject_to_uint64);
+	ue_py_register_converter(UFloatProperty::StaticClass(), ue_py_float_to_pyobject, ue_py_pyobject_to_float);
+	ue_py_register_converter(UByteProperty::StaticClass(), ue_py_byte_to_pyobject, ue_py_pyobject_to_byte);
+#if ENGINE_MINOR_VERSION >= 15
+	ue_py_register_converter(UEnumProperty::StaticClass(), ue_py_enum_to_pyobject, ue_py_pyobject_to_enum);
+	ue_py_register_converter(UMapProperty::StaticClass(), ue_py_map_to_pyobject, ue_py_pyobject_to_map);
+#endif
+	ue_py_register_converter(UStrProperty::StaticClass(), ue_py_str_to_pyobject, ue_py_pyobject_to_str);
+	ue_py_register_converter(UTextProperty::StaticClass(), ue_py_text_to_pyobject, ue_py_pyobject_to_text);
+	ue_py_register_converter(UNameProperty::StaticClass(), ue_py_name_to_pyobject, ue_py_pyobject_to_name);
+	ue_py_register_converter(UObjectPropertyBase::StaticClass(), ue_py_object_to_pyobject, ue_py_pyobject_to_object);
+	ue_py_register_converter(UInterfaceProperty::StaticClass(), ue_py_unsupported_to_pyobject, ue_py_pyobject_to_object);
+	ue_py_register_converter(UMulticastDelegateProperty::StaticClass(), ue_py_delegate_to_pyobject, ue_py_pyobject_to_unsupported);
+	ue_py_register_converter(UDelegateProperty::StaticClass(), ue_py_delegate_to_pyobject, ue_py_pyobject_to_unsupported);
+	ue_py_register_converter(UArrayProperty::StaticClass(), ue_py_array_to_pyobject, ue_py_pyobject_to_array);
+	ue_py_register_converter(UStructProperty::StaticClass(), GenericStructConverter.ToPython, GenericStructConverter.ToProperty);
+
+	ue_py_register_struct_converter(TBaseStructure<FVector>::Get(), ue_py_fvector_to_pyobject, ue_py_pyobject_to_fvector);
+	ue_py_register_struct_converter(TBaseStructure<FVector2D>::Get(), ue_py_fvector2d_to_pyobject, ue_py_pyobject_to_fvector2d);
+	ue_py_register_struct_converter(TBaseStructure<FRotator>::Get(), ue_py_frotator_to_pyobject, ue_py_pyobject_to_frotator);
+	ue_py_register_struct_converter(TBaseStructure<FTransform>::Get(), ue_py_ftransform_to_pyobject, ue_py_pyobject_to_ftransform);
+	ue_py_register_struct_converter(FHitResult::StaticStruct(), ue_py_fhitresult_to_pyobject, ue_py_pyobject_to_fhitresult);
+	ue_py_register_struct_converter(TBaseStructure<FColor>::Get(), ue_py_fcolor_to_pyobject, ue_py_pyobject_to_fcolor);
+	ue_py_register_struct_converter(TBaseStructure<FLinearColor>::Get(), ue_py_flinearcolor_to_pyobject, ue_py_pyobject_to_flinearcolor);
+}
+
+FPyPropertyConverter ue_py_get_property_converter(UProperty *prop)
+{
+	ue_py_init_property_converters();
+
+	UClass *prop_class = prop->GetClass();
+
+	if (prop_class == UStructProperty::StaticClass())
+	{
+		if (FPyPropertyConverter *Converter = StructConverters.Find(((UStructProperty *)prop)->Struct))
+		{
+			return *Converter;
+		}
+		return GenericStructConverter;
+	}
+
+	if (FPyPropertyConverter *Converter = ClassConverters.Find(prop_class))
+	{
+		return *Converter;
+	}
+
+	// first time we see this property class, resolve it and remember the result
+	FPyPropertyConverter Resolved = UnsupportedConverter;
+	for (UClass *u_class = prop_class->GetSuperClass(); u_class; u_class = u_class->GetSuperClass())
+	{
+		if (FPyPropertyConverter *Converter = ClassConverters.Find(u_class))
+		{
+			Resolved = *Converter;
+			break;
+		}
+	}
+	ClassConverters.Add(prop_class, Resolved);
+	return Resolved;
+}
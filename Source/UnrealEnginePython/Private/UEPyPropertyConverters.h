@@ -0,0 +1,20 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+typedef PyObject *(*ue_py_property_to_pyobject)(UProperty *, uint8 *, int32);
+typedef bool(*ue_py_pyobject_to_property)(PyObject *, UProperty *, uint8 *, int32);
+
+/*
+ * Converters are resolved once per UProperty class (and per UScriptStruct for the
+ * structs having a dedicated python wrapper), instead of testing a chain of Cast<>
+ * on every conversion.
+ */
+
+struct FPyPropertyConverter
+{
+	ue_py_property_to_pyobject ToPython;
+	ue_py_pyobject_to_property ToProperty;
+};
+
+FPyPropertyConverter ue_py_get_property_converter(UProperty *);
@@ -0,0 +1,373 @@
+#include "UEPyRenderTargetReadback.h"
+
+#include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Runtime/Core/Public/HAL/ThreadSafeBool.h"
+#include "Engine/TextureRenderTarget2D.h"
+#include "RHICommandList.h"
+#include "RenderingThread.h"
+#if PY_MAJOR_VERSION >= 3
+#include "UEPyAsyncLoop.h"
+#endif
+
+enum class EPyReadbackFormat : uint8
+{
+	// 8 bit BGRA
+	Color,
+	// half float RGBA
+	Float16,
+	// float RGBA
+	Float32,
+};
+
+static int32 ue_py_readback_bytes_per_pixel(EPyReadbackFormat Format)
+{
+	switch (Format)
+	{
+	case EPyReadbackFormat::Float16:
+		return sizeof(FFloat16Color);
+	case EPyReadbackFormat::Float32:
+		return sizeof(FLinearColor);
+	default:
+		break;
+	}
+	return sizeof(FColor);
+}
+
+static EPyReadbackFormat ue_py_readback_format(EPixelFormat PixelFormat)
+{
+	switch (PixelFormat)
+	{
+	// ReadSurfaceFloatData supports only this format (D3D11 asserts on the others)
+	case PF_FloatRGBA:
+		return EPyReadbackFormat::Float16;
+#if ENGINE_MINOR_VERSION > 16
+	// converted to float RGBA by the RHI, without losing precision
+	case PF_FloatRGB:
+	case PF_A32B32G32R32F:
+	case PF_R16F:
+	case PF_R16F_FILTER:
+	case PF_R32_FLOAT:
+	case PF_G16R16F:
+	case PF_G16R16F_FILTER:
+	case PF_G32R32F:
+		return EPyReadbackFormat::Float32;
+#endif
+	default:
+		break;
+	}
+	// every other format is converted to FColor by the RHI
+	return EPyReadbackFormat::Color;
+}
+
+// a slot of the ring, its staging arrays keep their allocation between readbacks
+struct FPyRenderTargetReadback
+{
+	FTextureRenderTargetResource *Resource;
+	FIntRect Rect;
+	EPyReadbackFormat Format;
+
+	// the object exporting the buffer (passed to the future or the callable)
+	PyObject *py_buffer_owner;
+	Py_buffer py_buf;
+	PyObject *py_future;
+	PyObject *py_callable;
+
+	TArray<FColor> Colors;
+	TArray<FFloat16Color> HalfColors;
+	TArray<FLinearColor> LinearColors;
+
+	bool bInUse;
+	// set by the render thread after filling the buffer
+	FThreadSafeBool bReady;
+	bool bSucceeded;
+
+	FPyRenderTargetReadback() : Resource(nullptr), py_buffer_owner(nullptr), py_future(nullptr), py_callable(nullptr), bInUse(false), bReady(false), bSucceeded(false)
+	{
+	}
+};
+
+// runs in the render thread, the python buffer is exported (so it cannot be resized) until the readback is completed
+static void ue_py_render_target_readback(FRHICommandListImmediate &RHICmdList, FPyRenderTargetReadback *Readback)
+{
+	Readback->bSucceeded = false;
+
+	FTexture2DRHIRef Texture = Readback->Resource->GetRenderTargetTexture();
+	if (Texture.IsValid())
+	{
+		const void *Data = nullptr;
+		int64 DataLen = 0;
+		switch (Readback->Format)
+		{
+		case EPyReadbackFormat::Float16:
+			Readback->HalfColors.Reset();
+			RHICmdList.ReadSurfaceFloatData(Texture, Readback->Rect, Readback->HalfColors, CubeFace_PosX, 0, 0);
+			Data = Readback->HalfColors.GetData();
+			DataLen = Readback->HalfColors.Num() * (int64)sizeof(FFloat16Color);
+			break;
+#if ENGINE_MINOR_VERSION > 16
+		case EPyReadbackFormat::Float32:
+			Readback->LinearColors.Reset();
+			// do not normalize the values
+			RHICmdList.ReadSurfaceData(Texture, Readback->Rect, Readback->LinearColors, FReadSurfaceDataFlags(RCM_MinMax));
+			Data = Readback->LinearColors.GetData();
+			DataLen = Readback->LinearColors.Num() * (int64)sizeof(FLinearColor);
+			break;
+#endif
+		default:
+			Readback->Colors.Reset();
+			RHICmdList.ReadSurfaceData(Texture, Readback->Rect, Readback->Colors, FReadSurfaceDataFlags());
+			Data = Readback->Colors.GetData();
+			DataLen = Readback->Colors.Num() * (int64)sizeof(FColor);
+			break;
+		}
+
+		int64 WantedLen = (int64)Readback->Rect.Area() * ue_py_readback_bytes_per_pixel(Readback->Format);
+		if (Data && DataLen >= WantedLen)
+		{
+			FMemory::Memcpy(Readback->py_buf.buf, Data, WantedLen);
+			Readback->bSucceeded = true;
+		}
+	}
+
+	Readback->bReady = true;
+}
+
+class FPythonRenderTargetReadbacks
+{
+public:
+	FPythonRenderTargetReadbacks() : MaxPending(4)
+	{
+	}
+
+	FPyRenderTargetReadback *GetFreeSlot()
+	{
+		if (Pending.Num() >= MaxPending)
+			return nullptr;
+
+		for (FPyRenderTargetReadback &Slot : Slots)
+		{
+			if (!Slot.bInUse)
+				return &Slot;
+		}
+
+		if (!TickerHandle.IsValid())
+			TickerHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPythonRenderTargetReadbacks::Tick));
+
+		return new(Slots) FPyRenderTargetReadback();
+	}
+
+	bool Tick(float DeltaTime)
+	{
+		if (Pending.Num() == 0)
+			return true;
+
+		FScopePythonGIL gil;
+
+		// render commands are executed in order, so are the readbacks
+		while (Pending.Num() > 0 && Pending[0]->bReady)
+		{
+			FPyRenderTargetReadback *Readback = Pending[0];
+			Pending.RemoveAt(0);
+			Complete(Readback);
+		}
+
+		return true;
+	}
+
+	void Complete(FPyRenderTargetReadback *Readback)
+	{
+		PyBuffer_Release(&Readback->py_buf);
+
+		PyObject *py_owner = Readback->py_buffer_owner;
+		PyObject *py_future = Readback->py_future;
+		PyObject *py_callable = Readback->py_callable;
+		bool bSucceeded = Readback->bSucceeded;
+
+		// the slot can be reused by the callable
+		Readback->py_buffer_owner = nullptr;
+		Readback->py_future = nullptr;
+		Readback->py_callable = nullptr;
+		Readback->Resource = nullptr;
+		Readback->bReady = false;
+		Readback->bInUse = false;
+
+		if (py_callable)
+		{
+			PyObject *ret = PyObject_CallFunctionObjArgs(py_callable, bSucceeded ? py_owner : Py_None, nullptr);
+			if (!ret)
+				unreal_engine_py_log_error();
+			Py_XDECREF(ret);
+			Py_DECREF(py_callable);
+		}
+
+#if PY_MAJOR_VERSION >= 3
+		if (py_future)
+		{
+			if (bSucceeded)
+				py_ue_async_resolve(py_future, py_owner);
+			else
+				py_ue_async_reject(py_future, "unable to read pixels");
+			Py_DECREF(py_future);
+		}
+#endif
+
+		Py_DECREF(py_owner);
+	}
+
+	int32 MaxPending;
+	TIndirectArray<FPyRenderTargetReadback> Slots;
+	TArray<FPyRenderTargetReadback *> Pending;
+	FDelegateHandle TickerHandle;
+};
+
+static FPythonRenderTargetReadbacks PythonRenderTargetReadbacks;
+
+PyObject *py_unreal_engine_flush_render_target_readbacks(PyObject * self, PyObject * args)
+{
+	if (PythonRenderTargetReadbacks.Pending.Num() == 0)
+		Py_RETURN_NONE;
+
+	// the render thread could need the GIL (python objects are not touched by the readbacks, but other commands could)
+	Py_BEGIN_ALLOW_THREADS;
+	FlushRenderingCommands();
+	Py_END_ALLOW_THREADS;
+
+	// futures are resolved (and callables called) now instead of the next tick
+	PythonRenderTargetReadbacks.Tick(0);
+	Py_RETURN_NONE;
+}
+
+PyObject *py_ue_render_target_get_data_async(ue_PyUObject *self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	PyObject *py_buffer = nullptr;
+	PyObject *py_callable = nullptr;
+
+	if (!PyArg_ParseTuple(args, "|OO:render_target_get_data_async", &py_buffer, &py_callable))
+	{
+		return nullptr;
+	}
+
+	UTextureRenderTarget2D *tex = ue_py_check_type<UTextureRenderTarget2D>(self);
+	if (!tex)
+		return PyErr_Format(PyExc_Exception, "object is not a TextureRenderTarget");
+
+	FTextureRenderTargetResource *resource = tex->GameThread_GetRenderTargetResource();
+	if (!resource)
+		return PyErr_Format(PyExc_Exception, "cannot get render target resource");
+
+	if (py_callable == Py_None)
+		py_callable = nullptr;
+
+	if (py_callable && !PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_Exception, "argument is not callable");
+
+#if PY_MAJOR_VERSION < 3
+	if (!py_callable)
+		return PyErr_Format(PyExc_Exception, "a callable is required");
+#endif
+
+	EPyReadbackFormat format = ue_py_readback_format(tex->GetFormat());
+	int32 width = tex->GetSurfaceWidth();
+	int32 height = tex->GetSurfaceHeight();
+	Py_ssize_t data_len = (Py_ssize_t)width * height * ue_py_readback_bytes_per_pixel(format);
+
+	PyObject *py_owner = nullptr;
+	if (py_buffer && py_buffer != Py_None)
+	{
+		py_owner = py_buffer;
+		Py_INCREF(py_owner);
+	}
+	else
+	{
+		py_owner = PyByteArray_FromStringAndSize(nullptr, data_len);
+		if (!py_owner)
+			return nullptr;
+	}
+
+	Py_buffer py_buf;
+	if (PyObject_GetBuffer(py_owner, &py_buf, PyBUF_WRITABLE) < 0)
+	{
+		Py_DECREF(py_owner);
+		return nullptr;
+	}
+
+	if (py_buf.len < data_len)
+	{
+		PyBuffer_Release(&py_buf);
+		Py_DECREF(py_owner);
+		return PyErr_Format(PyExc_Exception, "buffer is not big enough (%d bytes required)", (int)data_len);
+	}
+
+	PyObject *py_future = nullptr;
+#if PY_MAJOR_VERSION >= 3
+	if (!py_callable)
+	{
+		py_future = py_ue_async_new_future();
+		if (!py_future)
+		{
+			PyBuffer_Release(&py_buf);
+			Py_DECREF(py_owner);
+			return nullptr;
+		}
+	}
+#endif
+
+	FPyRenderTargetReadback *Readback = PythonRenderTargetReadbacks.GetFreeSlot();
+	if (!Readback)
+	{
+		PyBuffer_Release(&py_buf);
+		Py_DECREF(py_owner);
+		Py_XDECREF(py_future);
+		return PyErr_Format(PyExc_Exception, "too many pending readbacks (%d)", PythonRenderTargetReadbacks.MaxPending);
+	}
+
+	Readback->Resource = resource;
+	Readback->Rect = FIntRect(0, 0, width, height);
+	Readback->Format = format;
+	Readback->py_buffer_owner = py_owner;
+	Readback->py_buf = py_buf;
+	Readback->py_callable = py_callable;
+	Py_XINCREF(py_callable);
+	Readback->py_future = py_future;
+	Readback->bReady = false;
+	Readback->bInUse = true;
+	PythonRenderTargetReadbacks.Pending.Add(Readback);
+
+#if ENGINE_MINOR_VERSION >= 22
+	ENQUEUE_RENDER_COMMAND(PyRenderTargetReadback)([Readback](FRHICommandListImmediate &RHICmdList)
+	{
+		ue_py_render_target_readback(RHICmdList, Readback);
+	});
+#else
+	ENQUEUE_UNIQUE_RENDER_COMMAND_ONEPARAMETER(PyRenderTargetReadback, FPyRenderTargetReadback *, Readback, Readback,
+	{
+		ue_py_render_target_readback(RHICmdList, Readback);
+	});
+#endif
+
+	if (py_future)
+	{
+		Py_INCREF(py_future);
+		return py_future;
+	}
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_set_render_target_readback_slots(PyObject * self, PyObject * args)
+{
+	int slots;
+	if (!PyArg_ParseTuple(args, "i:set_render_target_readback_slots", &slots))
+	{
+		return nullptr;
+	}
+
+	if (slots < 1)
+		return PyErr_Format(PyExc_ValueError, "at least one slot is required");
+
+	PythonRenderTargetReadbacks.MaxPending = slots;
+	Py_RETURN_NONE;
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+// render target readbacks executed by the render thread (the game thread is never stalled)
+
+PyObject *py_ue_render_target_get_data_async(ue_PyUObject *, PyObject *);
+PyObject *py_unreal_engine_set_render_target_readback_slots(PyObject *, PyObject *);
+PyObject *py_unreal_engine_flush_render_target_readbacks(PyObject *, PyObject *);
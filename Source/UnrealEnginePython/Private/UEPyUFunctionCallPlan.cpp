@@ -0,0 +1,237 @@
+#include "UEPyUFunctionCallPlan.h"
+
+#include "Runtime/Core/Public/UObject/PropertyPortFlags.h"
+
+FUnrealEnginePythonCallPlanCache *FUnrealEnginePythonCallPlanCache::Get()
+{
+	static FUnrealEnginePythonCallPlanCache *Singleton;
+	if (!Singleton)
+	{
+		Singleton = new FUnrealEnginePythonCallPlanCache();
+		Singleton->ActiveCalls = 0;
+		// UFunction addresses could be recycled after a GC
+#if ENGINE_MINOR_VERSION >= 18
+		FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(Singleton, &FUnrealEnginePythonCallPlanCache::RunGCDelegate);
+#else
+		FCoreUObjectDelegates::PostGarbageCollect.AddRaw(Singleton, &FUnrealEnginePythonCallPlanCache::RunGCDelegate);
+#endif
+	}
+	return Singleton;
+}
+
+void FUnrealEnginePythonCallPlanCache::RunGCDelegate()
+{
+	FScopePythonGIL gil;
+	Invalidate();
+}
+
+void FUnrealEnginePythonCallPlanCache::Invalidate()
+{
+	for (auto &Pair : Plans)
+	{
+		ReleasePlan(Pair.Value);
+	}
+	Plans.Empty();
+}
+
+void FUnrealEnginePythonCallPlanCache::BeginCall()
+{
+	ActiveCalls++;
+}
+
+void FUnrealEnginePythonCallPlanCache::EndCall()
+{
+	ActiveCalls--;
+	if (ActiveCalls == 0 && PendingFreePlans.Num() > 0)
+	{
+		for (FPyUFunctionCallPlan *Plan : PendingFreePlans)
+		{
+			FreePlan(Plan);
+		}
+		PendingFreePlans.Empty();
+	}
+}
+
+void FUnrealEnginePythonCallPlanCache::ReleasePlan(FPyUFunctionCallPlan *Plan)
+{
+	if (ActiveCalls > 0)
+	{
+		PendingFreePlans.Add(Plan);
+		return;
+	}
+	FreePlan(Plan);
+}
+
+FPyUFunctionCallPlan *FUnrealEnginePythonCallPlanCache::FindOrBuild(UFunction *Function)
+{
+	FPyUFunctionCallPlan **CachedPlan = Plans.Find(Function);
+	if (CachedPlan)
+	{
+		FPyUFunctionCallPlan *Plan = *CachedPlan;
+		if (Plan->Signature == Function->Children && Plan->ParmsSize == Function->ParmsSize)
+		{
+			return Plan;
+		}
+		ReleasePlan(Plan);
+		Plans.Remove(Function);
+	}
+
+	FPyUFunctionCallPlan *Plan = Build(Function);
+	if (!Plan)
+		return nullptr;
+	Plans.Add(Function, Plan);
+	return Plan;
+}
+
+static PyObject *ue_py_intern_property_name(UProperty *Property)
+{
+#if PY_MAJOR_VERSION >= 3
+	return PyUnicode_InternFromString(TCHAR_TO_UTF8(*Property->GetName()));
+#else
+	return PyString_InternFromString(TCHAR_TO_UTF8(*Property->GetName()));
+#endif
+}
+
+static FPyUFunctionParam ue_py_make_param(UProperty *Property)
+{
+	FPyUFunctionParam Param;
+	Param.Property = Property;
+	Param.PyName = ue_py_intern_property_name(Property);
+	FPyPropertyConverter Converter = ue_py_get_property_converter(Property);
+	Param.ToProperty = Converter.ToProperty;
+	Param.ToPython = Converter.ToPython;
+	return Param;
+}
+
+static bool ue_py_is_out_param(UProperty *Property)
+{
+	return Property->HasAnyPropertyFlags(CPF_OutParm) && (Property->IsA<UArrayProperty>() || Property->HasAnyPropertyFlags(CPF_ConstParm) == false);
+}
+
+FPyUFunctionCallPlan *FUnrealEnginePythonCallPlanCache::Build(UFunction *Function)
+{
+	FPyUFunctionCallPlan *Plan = new FPyUFunctionCallPlan();
+	Plan->Signature = Function->Children;
+	Plan->ParmsSize = Function->ParmsSize;
+	Plan->bHasReturnParam = false;
+	Plan->ReturnParam.PyName = nullptr;
+	Plan->bPlainOldData = true;
+	//NOTE: u_function->PropertiesSize maps to local variable uproperties + ufunction paramaters uproperties
+	Plan->Defaults = (uint8 *)FMemory::Malloc(FMath::Max(Function->ParmsSize, 1));
+	FMemory::Memzero(Plan->Defaults, FMath::Max(Function->ParmsSize, 1));
+
+	bool bInputParams = true;
+	for (TFieldIterator<UProperty> IArgs(Function); IArgs && IArgs->HasAnyPropertyFlags(CPF_Parm); ++IArgs)
+	{
+		UProperty *Property = *IArgs;
+
+		if (!Property->HasAnyPropertyFlags(CPF_ZeroConstructor))
+		{
+			Plan->InitParams.Add(Property);
+			Property->InitializeValue_InContainer(Plan->Defaults);
+		}
+		if (!Property->HasAnyPropertyFlags(CPF_NoDestructor))
+		{
+			Plan->DestroyParams.Add(Property);
+		}
+		if (!Property->HasAnyPropertyFlags(CPF_IsPlainOldData))
+		{
+			Plan->bPlainOldData = false;
+		}
+
+		if (Property->HasAnyPropertyFlags(CPF_ReturnParm))
+		{
+			// the return value is always the first returned item
+			if (!Plan->bHasReturnParam)
+			{
+				Plan->ReturnParam = ue_py_make_param(Property);
+				Plan->bHasReturnParam = true;
+			}
+			bInputParams = false;
+			continue;
+		}
+
+		//UObject::CallFunctionByNameWithArguments() only does this part on non return value params
+		if (!Property->IsInContainer(Function->ParmsSize))
+		{
+			PyErr_Format(PyExc_Exception, "Attempting to import func param property that's out of bounds. %s", TCHAR_TO_UTF8(*Function->GetName()));
+			FreePlan(Plan);
+			return nullptr;
+		}
+
+#if WITH_EDITOR
+		FString default_key = FString("CPP_Default_") + Property->GetName();
+		FString default_key_value = Function->GetMetaData(FName(*default_key));
+		if (!default_key_value.IsEmpty())
+		{
+#if ENGINE_MINOR_VERSION >= 17
+			Property->ImportText(*default_key_value, Property->ContainerPtrToValuePtr<uint8>(Plan->Defaults), PPF_None, NULL);
+#else
+			Property->ImportText(*default_key_value, Property->ContainerPtrToValuePtr<uint8>(Plan->Defaults), PPF_Localized, NULL);
+#endif
+			Plan->DefaultParams.Add(Property);
+		}
+#endif
+
+		// parameters after the return value cannot be passed from python
+		if (bInputParams)
+		{
+			Plan->InputParams.Add(ue_py_make_param(Property));
+		}
+
+		if (ue_py_is_out_param(Property))
+		{
+			Plan->OutParams.Add(ue_py_make_param(Property));
+		}
+	}
+
+	return Plan;
+}
+
+void FUnrealEnginePythonCallPlanCache::FreePlan(FPyUFunctionCallPlan *Plan)
+{
+	Plan->DestroyParms(Plan->Defaults);
+	FMemory::Free(Plan->Defaults);
+
+	for (FPyUFunctionParam &Param : Plan->InputParams)
+	{
+		Py_XDECREF(Param.PyName);
+	}
+	for (FPyUFunctionParam &Param : Plan->OutParams)
+	{
+		Py_XDECREF(Param.PyName);
+	}
+	if (Plan->bHasReturnParam)
+	{
+		Py_XDECREF(Plan->ReturnParam.PyName);
+	}
+
+	delete Plan;
+}
+
+void FPyUFunctionCallPlan::InitParms(uint8 *Buffer) const
+{
+	if (bPlainOldData)
+	{
+		FMemory::Memcpy(Buffer, Defaults, ParmsSize);
+		return;
+	}
+
+	FMemory::Memzero(Buffer, ParmsSize);
+	for (UProperty *Property : InitParams)
+	{
+		Property->InitializeValue_InContainer(Buffer);
+	}
+	for (UProperty *Property : DefaultParams)
+	{
+		Property->CopyCompleteValue_InContainer(Buffer, Defaults);
+	}
+}
+
+void FPyUFunctionCallPlan::DestroyParms(uint8 *Buffer) const
+{
+	for (UProperty *Property : DestroyParams)
+	{
+		Property->DestroyValue_InContainer(Buffer);
+	}
+}
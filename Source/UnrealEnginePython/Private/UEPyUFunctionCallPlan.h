@@ -0,0 +1,70 @@
+#pragma once
+
+#include "UEPyPropertyConverters.h"
+
+/*
+ * Everything py_ue_ufunction_call needs to know about a UFunction signature,
+ * computed once (no TFieldIterator walks, metadata lookups or name conversions per call).
+ */
+
+struct FPyUFunctionParam
+{
+	UProperty *Property;
+	// interned python string used for kwargs lookups
+	PyObject *PyName;
+	ue_py_pyobject_to_property ToProperty;
+	ue_py_property_to_pyobject ToPython;
+};
+
+struct FPyUFunctionCallPlan
+{
+	// value used for detecting a regenerated signature
+	UField *Signature;
+	int32 ParmsSize;
+
+	// parameters that can be passed from python (in declaration order)
+	TArray<FPyUFunctionParam> InputParams;
+	// parameters returned to python after the return value
+	TArray<FPyUFunctionParam> OutParams;
+	FPyUFunctionParam ReturnParam;
+	bool bHasReturnParam;
+
+	// parameters requiring a constructor call
+	TArray<UProperty *> InitParams;
+	// parameters with a CPP_Default_ value stored in the Defaults block
+	TArray<UProperty *> DefaultParams;
+	// parameters requiring a destructor call
+	TArray<UProperty *> DestroyParams;
+
+	// parameters block with initialized values and pre-parsed defaults
+	uint8 *Defaults;
+	// if true the Defaults block can be simply memcpy'ed
+	bool bPlainOldData;
+
+	void InitParms(uint8 *Buffer) const;
+	void DestroyParms(uint8 *Buffer) const;
+};
+
+class FUnrealEnginePythonCallPlanCache
+{
+public:
+	static FUnrealEnginePythonCallPlanCache *Get();
+
+	// returns nullptr (with python error set) if the function cannot be called from python
+	FPyUFunctionCallPlan *FindOrBuild(UFunction *Function);
+	void Invalidate();
+
+	// plans are never freed while a call is running (ProcessEvent can reenter python)
+	void BeginCall();
+	void EndCall();
+
+private:
+	FPyUFunctionCallPlan *Build(UFunction *Function);
+	void FreePlan(FPyUFunctionCallPlan *Plan);
+	void ReleasePlan(FPyUFunctionCallPlan *Plan);
+	void RunGCDelegate();
+
+	TMap<UFunction *, FPyUFunctionCallPlan *> Plans;
+	TArray<FPyUFunctionCallPlan *> PendingFreePlans;
+	int32 ActiveCalls;
+};
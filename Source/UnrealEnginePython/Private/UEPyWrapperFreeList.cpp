@@ -0,0 +1,141 @@
+#include "UEPyWrapperFreeList.h"
+
+FPyWrapperFreeList::FPyWrapperFreeList(PyTypeObject *InType) : Type(InType), Capacity(UEPY_WRAPPER_FREELIST_DEFAULT_CAPACITY), Hits(0), Misses(0), Released(0)
+{
+	GetAll().Add(this);
+}
+
+TArray<FPyWrapperFreeList *> &FPyWrapperFreeList::GetAll()
+{
+	// function local to not depend on the initialization order of the translation units
+	static TArray<FPyWrapperFreeList *> FreeLists;
+	return FreeLists;
+}
+
+PyObject *FPyWrapperFreeList::Alloc()
+{
+	if (Items.Num() > 0)
+	{
+		Hits++;
+		PyObject *Object = Items.Pop(false);
+		return PyObject_INIT(Object, Type);
+	}
+	Misses++;
+	return PyObject_New(PyObject, Type);
+}
+
+PyObject *FPyWrapperFreeList::AllocZeroed(PyTypeObject *InType)
+{
+	if (InType != Type)
+		return PyType_GenericAlloc(InType, 0);
+
+	if (Items.Num() > 0)
+	{
+		Hits++;
+		PyObject *Object = Items.Pop(false);
+		FMemory::Memzero(Object, Type->tp_basicsize);
+		return PyObject_INIT(Object, Type);
+	}
+	Misses++;
+	return PyType_GenericAlloc(Type, 0);
+}
+
+void FPyWrapperFreeList::Free(PyObject *Object)
+{
+	if (Py_TYPE(Object) != Type || Items.Num() >= Capacity)
+	{
+		Released++;
+		Py_TYPE(Object)->tp_free(Object);
+		return;
+	}
+	Items.Add(Object);
+}
+
+void FPyWrapperFreeList::SetCapacity(int32 NewCapacity)
+{
+	Capacity = FMath::Max(NewCapacity, 0);
+	while (Items.Num() > Capacity)
+	{
+		Type->tp_free(Items.Pop(false));
+	}
+}
+
+void FPyWrapperFreeList::Clear()
+{
+	for (PyObject *Object : Items)
+	{
+		Type->tp_free(Object);
+	}
+	Items.Empty();
+}
+
+const char *FPyWrapperFreeList::GetName() const
+{
+	const char *Name = strrchr(Type->tp_name, '.');
+	return Name ? Name + 1 : Type->tp_name;
+}
+
+PyObject *FPyWrapperFreeList::GetStats()
+{
+	PyObject *py_stats = PyDict_New();
+	PyObject *py_value = PyLong_FromLong(Capacity);
+	PyDict_SetItemString(py_stats, "capacity", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromLong(Items.Num());
+	PyDict_SetItemString(py_stats, "size", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Hits);
+	PyDict_SetItemString(py_stats, "hits", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Misses);
+	PyDict_SetItemString(py_stats, "misses", py_value);
+	Py_DECREF(py_value);
+	py_value = PyLong_FromUnsignedLongLong(Released);
+	PyDict_SetItemString(py_stats, "released", py_value);
+	Py_DECREF(py_value);
+	return py_stats;
+}
+
+PyObject *py_unreal_engine_get_wrapper_freelist_stats(PyObject * self, PyObject * args)
+{
+	PyObject *py_dict = PyDict_New();
+	for (FPyWrapperFreeList *FreeList : FPyWrapperFreeList::GetAll())
+	{
+		PyObject *py_stats = FreeList->GetStats();
+		PyDict_SetItemString(py_dict, FreeList->GetName(), py_stats);
+		Py_DECREF(py_stats);
+	}
+	return py_dict;
+}
+
+PyObject *py_unreal_engine_set_wrapper_freelist_capacity(PyObject * self, PyObject * args)
+{
+	int capacity;
+	char *name = nullptr;
+	if (!PyArg_ParseTuple(args, "i|s:set_wrapper_freelist_capacity", &capacity, &name))
+		return nullptr;
+
+	bool found = false;
+	for (FPyWrapperFreeList *FreeList : FPyWrapperFreeList::GetAll())
+	{
+		if (!name || !strcmp(FreeList->GetName(), name))
+		{
+			FreeList->SetCapacity(capacity);
+			found = true;
+		}
+	}
+
+	if (!found)
+		return PyErr_Format(PyExc_ValueError, "unknown wrapper freelist %s", name);
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_clear_wrapper_freelists(PyObject * self, PyObject * args)
+{
+	for (FPyWrapperFreeList *FreeList : FPyWrapperFreeList::GetAll())
+	{
+		FreeList->Clear();
+	}
+	Py_RETURN_NONE;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+/*
+ * Per-type cache of deallocated wrappers (the same idea of the CPython float freelist).
+ *
+ * Small fixed-size wrappers (FVector, FRotator, FQuat, FTransform, FHitResult) are created for every
+ * value returned to python, so instead of giving their memory back to the allocator we keep
+ * up to Capacity of them and reinitialize them on the next allocation.
+ * Subclasses (if any) are never cached as their size could be different.
+ */
+
+#define UEPY_WRAPPER_FREELIST_DEFAULT_CAPACITY 256
+
+class FPyWrapperFreeList
+{
+public:
+	FPyWrapperFreeList(PyTypeObject *InType);
+
+	// returns a new reference, with the fields after PyObject_HEAD left uninitialized
+	PyObject *Alloc();
+	// tp_alloc compatible version, the object memory is zeroed
+	PyObject *AllocZeroed(PyTypeObject *InType);
+	// tp_dealloc body
+	void Free(PyObject *Object);
+
+	void SetCapacity(int32 NewCapacity);
+	void Clear();
+
+	PyObject *GetStats();
+
+	const char *GetName() const;
+
+	static TArray<FPyWrapperFreeList *> &GetAll();
+
+private:
+	PyTypeObject *Type;
+	TArray<PyObject *> Items;
+	int32 Capacity;
+
+	uint64 Hits;
+	uint64 Misses;
+	// objects given back to the allocator because the freelist was full
+	uint64 Released;
+};
+
+PyObject *py_unreal_engine_get_wrapper_freelist_stats(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_wrapper_freelist_capacity(PyObject *, PyObject *);
+PyObject *py_unreal_engine_clear_wrapper_freelists(PyObject *, PyObject *);
@@ -24,16 +24,277 @@ for a queue of UMovieSceneCapture objects
 #include "Runtime/CoreUObject/Public/Serialization/ObjectWriter.h"
 #include "Runtime/Slate/Public/Framework/Application/SlateApplication.h"
 #include "Runtime/Core/Public/Containers/Ticker.h"
+#include "Runtime/MovieSceneCapture/Public/FrameGrabber.h"
+#include "Runtime/MovieSceneCapture/Public/Protocols/FrameGrabberProtocol.h"
+#if ENGINE_MINOR_VERSION < 20
+#include "Runtime/MovieSceneCapture/Public/MovieSceneCaptureModule.h"
+#include "Runtime/MovieSceneCapture/Public/MovieSceneCaptureProtocolRegistry.h"
+#endif
+#include "UEPyTexture.h"
+
+// frames streamed to python while capturing (instead of the output of the capture protocol)
+struct FPyCaptureFrameSink
+{
+	// callable or queue (new reference)
+	PyObject *py_sink;
+	bool bQueue;
+	// queues only, frames are dropped instead of blocking when the queue is full
+	bool bDropFrames;
+	// asyncio.Queue: put() is a coroutine, so put_nowait() is always used and frames are dropped when the queue is full
+	bool bAsyncQueue;
+	// 'raw', 'png' or 'jpeg'
+	FString Format;
+	// number of frames in flight between the GPU and python
+	int32 MaxPendingFrames;
+};
+
+// metrics of the captured frame, they come back with its pixels
+struct FPyFramePayload : IFramePayload
+{
+	FPyFramePayload(const FFrameMetrics &InMetrics) : Metrics(InMetrics) {}
+
+	FFrameMetrics Metrics;
+};
+
+// receives the frames captured by the frame sink protocol (in the game thread) and forwards them to python
+struct FPythonFrameSink
+{
+	FPythonFrameSink(const FPyCaptureFrameSink &InSettings, UMovieSceneCapture *InCapture)
+	{
+		Settings = InSettings;
+		Capture = InCapture;
+		py_queue_full = nullptr;
+		DroppedFrames = 0;
+	}
+
+	// the GIL must be held
+	bool Begin()
+	{
+		if (Settings.Format != TEXT("raw"))
+		{
+			FrameImageWrapper = ue_py_new_image_wrapper(TCHAR_TO_UTF8(*Settings.Format));
+			if (!FrameImageWrapper.IsValid())
+				return false;
+		}
+
+		if (Settings.bQueue && (Settings.bDropFrames || Settings.bAsyncQueue))
+		{
+			// queue.Full and asyncio.QueueFull
+			py_queue_full = PyTuple_New(0);
+			PyObject *py_queue = PyImport_ImportModule("queue");
+			PyObject *py_full = py_queue ? PyObject_GetAttrString(py_queue, "Full") : nullptr;
+			PyObject *py_asyncio = PyImport_ImportModule("asyncio");
+			PyObject *py_asyncio_full = py_asyncio ? PyObject_GetAttrString(py_asyncio, "QueueFull") : nullptr;
+			PyErr_Clear();
+			if (py_full && py_asyncio_full)
+			{
+				Py_DECREF(py_queue_full);
+				py_queue_full = PyTuple_Pack(2, py_full, py_asyncio_full);
+			}
+			else if (py_full)
+			{
+				Py_DECREF(py_queue_full);
+				py_queue_full = PyTuple_Pack(1, py_full);
+			}
+			Py_XDECREF(py_queue);
+			Py_XDECREF(py_full);
+			Py_XDECREF(py_asyncio);
+			Py_XDECREF(py_asyncio_full);
+		}
+		return true;
+	}
+
+	void ProcessFrame(FCapturedFrameData &Frame)
+	{
+		FPyFramePayload *Payload = Frame.GetPayload<FPyFramePayload>();
+		if (!Settings.py_sink || !Payload)
+			return;
+
+		FScopePythonGIL gil;
+
+		ue_PyUObject *py_capture = ue_get_python_uobject(Capture);
+		if (!py_capture)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+
+		PyObject *py_data = nullptr;
+		const char *format = "BGRA8";
+		FTCHARToUTF8 CompressedFormat(*Settings.Format);
+
+		if (FrameImageWrapper.IsValid())
+		{
+			const TArray<uint8> *Compressed = nullptr;
+			// python threads (like the frames consumers) can run while compressing
+			Py_BEGIN_ALLOW_THREADS;
+			if (FrameImageWrapper->SetRaw(Frame.ColorBuffer.GetData(), Frame.ColorBuffer.Num() * sizeof(FColor), Frame.BufferSize.X, Frame.BufferSize.Y, ERGBFormat::BGRA, 8))
+			{
+				Compressed = &FrameImageWrapper->GetCompressed(0);
+			}
+			Py_END_ALLOW_THREADS;
+			if (!Compressed)
+			{
+				UE_LOG(LogPython, Error, TEXT("unable to compress frame %u"), Payload->Metrics.FrameNumber);
+				return;
+			}
+			py_data = PyBytes_FromStringAndSize((const char *)Compressed->GetData(), Compressed->Num());
+			format = CompressedFormat.Get();
+		}
+		else
+		{
+			py_data = PyByteArray_FromStringAndSize((const char *)Frame.ColorBuffer.GetData(), Frame.ColorBuffer.Num() * sizeof(FColor));
+		}
+
+		if (!py_data)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+
+		PyObject *py_frame = Py_BuildValue("(OINiis)", py_capture, (unsigned int)Payload->Metrics.FrameNumber, py_data, Frame.BufferSize.X, Frame.BufferSize.Y, format);
+		if (!py_frame)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+
+		SendFrame(py_frame);
+		Py_DECREF(py_frame);
+	}
+
+	void SendFrame(PyObject *py_frame)
+	{
+		PyObject *ret = nullptr;
+		if (!Settings.bQueue)
+		{
+			// the callable blocks the game thread, so it applies backpressure by itself
+			ret = PyObject_CallObject(Settings.py_sink, py_frame);
+		}
+		else if (Settings.bDropFrames || Settings.bAsyncQueue)
+		{
+			ret = PyObject_CallMethod(Settings.py_sink, (char *)"put_nowait", (char *)"O", py_frame);
+			if (!ret && py_queue_full && PyErr_ExceptionMatches(py_queue_full))
+			{
+				PyErr_Clear();
+				DroppedFrames++;
+				return;
+			}
+		}
+		else
+		{
+			// waits (without holding the GIL) for a free slot
+			ret = PyObject_CallMethod(Settings.py_sink, (char *)"put", (char *)"O", py_frame);
+		}
+
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+			return;
+		}
+		Py_DECREF(ret);
+	}
+
+	// frames arriving later (the protocol could outlive the capture session) are ignored
+	void End()
+	{
+		if (DroppedFrames > 0)
+		{
+			UE_LOG(LogPython, Warning, TEXT("%d captured frames dropped by the python frame sink"), DroppedFrames);
+		}
+
+		FrameImageWrapper.Reset();
+		// the reference to the sink is owned by FInEditorMultiCapture
+		Settings.py_sink = nullptr;
+
+		FScopePythonGIL gil;
+		Py_CLEAR(py_queue_full);
+	}
+
+	FPyCaptureFrameSink Settings;
+	UMovieSceneCapture *Capture;
+	TSharedPtr<IImageWrapper> FrameImageWrapper;
+	// exceptions raised by put_nowait() on full queues
+	PyObject *py_queue_full;
+	int32 DroppedFrames;
+};
+
+#if ENGINE_MINOR_VERSION < 20
+static const TCHAR *ue_py_frame_sink_protocol = TEXT("PythonFrameSink");
+
+// capture protocol sending the frames to python (registered only while a capture with a frame sink runs)
+struct FPythonFrameSinkProtocol : FFrameGrabberProtocol
+{
+	FPythonFrameSinkProtocol(TSharedRef<FPythonFrameSink> InSink) : Sink(InSink)
+	{
+		DesiredPixelFormat = PF_B8G8R8A8;
+		RingBufferSize = InSink->Settings.MaxPendingFrames;
+	}
+
+protected:
+	virtual FFramePayloadPtr GetFramePayload(const FFrameMetrics& FrameMetrics, const ICaptureProtocolHost& Host) override
+	{
+		return FFramePayloadPtr(new FPyFramePayload(FrameMetrics));
+	}
+
+	virtual void ProcessFrame(FCapturedFrameData Frame) override
+	{
+		Sink->ProcessFrame(Frame);
+	}
+
+	TSharedRef<FPythonFrameSink> Sink;
+};
+#else
+// capture protocol sending the frames to python. Capture protocols are UObjects since 4.20,
+// this one is an intrinsic class as UHT cannot parse a subclass of UFrameGrabberProtocol on older engines
+class UPythonFrameSinkProtocol : public UFrameGrabberProtocol
+{
+	DECLARE_CLASS_INTRINSIC(UPythonFrameSinkProtocol, UFrameGrabberProtocol, CLASS_Transient, TEXT("/Script/UnrealEnginePython"))
+
+public:
+	// the capture creates the protocol instance, it gets the sink when set up
+	static TWeakPtr<FPythonFrameSink> PendingSink;
+
+protected:
+	virtual bool SetupImpl() override
+	{
+		Sink = PendingSink.Pin();
+		if (!Sink.IsValid())
+			return false;
+		DesiredPixelFormat = PF_B8G8R8A8;
+		RingBufferSize = Sink->Settings.MaxPendingFrames;
+		return Super::SetupImpl();
+	}
+
+	virtual FFramePayloadPtr GetFramePayload(const FFrameMetrics& FrameMetrics) override
+	{
+		return FFramePayloadPtr(new FPyFramePayload(FrameMetrics));
+	}
+
+	virtual void ProcessFrame(FCapturedFrameData Frame) override
+	{
+		if (Sink.IsValid())
+			Sink->ProcessFrame(Frame);
+	}
+
+	TSharedPtr<FPythonFrameSink> Sink;
+};
+
+TWeakPtr<FPythonFrameSink> UPythonFrameSinkProtocol::PendingSink;
+
+IMPLEMENT_INTRINSIC_CLASS(UPythonFrameSinkProtocol, , UFrameGrabberProtocol, MOVIESCENECAPTURE_API, "/Script/UnrealEnginePython", {})
+#endif
 
 
 struct FInEditorMultiCapture : TSharedFromThis<FInEditorMultiCapture>
 {
 
-	static TWeakPtr<FInEditorMultiCapture> CreateInEditorMultiCapture(TArray<UMovieSceneCapture*> InCaptureObjects, PyObject *py_callable)
+	static TWeakPtr<FInEditorMultiCapture> CreateInEditorMultiCapture(TArray<UMovieSceneCapture*> InCaptureObjects, PyObject *py_callable, const FPyCaptureFrameSink &InFrameSink)
 	{
 		// FInEditorCapture owns itself, so should only be kept alive by itself, or a pinned (=> temporary) weakptr
 		FInEditorMultiCapture* Capture = new FInEditorMultiCapture;
 		Capture->CaptureObjects = InCaptureObjects;
+		Capture->FrameSink = InFrameSink;
 		Capture->py_callable = py_callable;
 		if (Capture->py_callable)
 			Py_INCREF(Capture->py_callable);
@@ -49,6 +310,7 @@ private:
 	FInEditorMultiCapture()
 	{
 		CapturingFromWorld = nullptr;
+		FrameSink.py_sink = nullptr;
 	}
 
 	void Die()
@@ -57,11 +319,13 @@ private:
 		{
 			SceneCapture->RemoveFromRoot();
 		}
-		OnlyStrongReference = nullptr;
 		{
 			FScopePythonGIL gil;
 			Py_XDECREF(py_callable);
+			Py_XDECREF(FrameSink.py_sink);
 		}
+		// this could destroy the object, so it must be the last step
+		OnlyStrongReference = nullptr;
 	}
 
 	void Dequeue()
@@ -240,6 +504,11 @@ private:
 						CapturingFromWorld->GetWorldSettings()->DefaultGameMode = CurrentCaptureObject->Settings.GameModeOverride;
 					}
 
+					if (FrameSink.py_sink)
+					{
+						StartFrameSink();
+					}
+
 					CurrentCaptureObject->Initialize(SlatePlayInEditorSession->SlatePlayInEditorWindowViewport, Context.PIEInstance);
 				}
 				return;
@@ -248,6 +517,55 @@ private:
 
 	}
 
+	// the frames are sent to python by the frame sink protocol instead of being written by the protocol of the capture
+	void StartFrameSink()
+	{
+		TSharedRef<FPythonFrameSink> Sink = MakeShareable(new FPythonFrameSink(FrameSink, CurrentCaptureObject));
+		{
+			FScopePythonGIL gil;
+			if (!Sink->Begin())
+			{
+				unreal_engine_py_log_error();
+				return;
+			}
+		}
+		CurrentFrameSink = Sink;
+
+#if ENGINE_MINOR_VERSION < 20
+		FMovieSceneCaptureProtocolInfo ProtocolInfo;
+		ProtocolInfo.DisplayName = FText::FromString(ue_py_frame_sink_protocol);
+		ProtocolInfo.SettingsClassType = nullptr;
+		ProtocolInfo.Factory = [Sink]() -> TSharedRef<IMovieSceneCaptureProtocol> { return MakeShareable(new FPythonFrameSinkProtocol(Sink)); };
+		IMovieSceneCaptureModule::Get().GetProtocolRegistry().RegisterProtocol(FCaptureProtocolID(FName(ue_py_frame_sink_protocol)), ProtocolInfo);
+
+		BackedUpCaptureType = CurrentCaptureObject->CaptureType;
+		CurrentCaptureObject->CaptureType = FCaptureProtocolID(FName(ue_py_frame_sink_protocol));
+#else
+		UPythonFrameSinkProtocol::PendingSink = Sink;
+
+		BackedUpImageCaptureProtocolType = CurrentCaptureObject->ImageCaptureProtocolType;
+		CurrentCaptureObject->SetImageCaptureProtocolType(UPythonFrameSinkProtocol::StaticClass());
+#endif
+	}
+
+	// must be called after the capture has been closed (so the protocol has processed the pending frames)
+	void StopFrameSink()
+	{
+		if (!CurrentFrameSink.IsValid())
+			return;
+
+#if ENGINE_MINOR_VERSION < 20
+		CurrentCaptureObject->CaptureType = BackedUpCaptureType;
+		IMovieSceneCaptureModule::Get().GetProtocolRegistry().UnRegisterProtocol(FCaptureProtocolID(FName(ue_py_frame_sink_protocol)));
+#else
+		UPythonFrameSinkProtocol::PendingSink.Reset();
+		CurrentCaptureObject->SetImageCaptureProtocolType(BackedUpImageCaptureProtocolType.TryLoadClass<UMovieSceneCaptureProtocolBase>());
+#endif
+
+		CurrentFrameSink->End();
+		CurrentFrameSink.Reset();
+	}
+
 	void Shutdown()
 	{
 		FEditorDelegates::EndPIE.RemoveAll(this);
@@ -287,6 +605,8 @@ private:
 		CurrentCaptureObject->Close();
 		//CurrentCaptureObject->RemoveFromRoot();
 
+		StopFrameSink();
+
 	}
 	void OnEndPIE(bool bIsSimulating)
 	{
@@ -335,18 +655,82 @@ private:
 	TArray<UMovieSceneCapture*> CaptureObjects;
 
 	PyObject *py_callable;
+
+	FPyCaptureFrameSink FrameSink;
+	TSharedPtr<FPythonFrameSink> CurrentFrameSink;
+#if ENGINE_MINOR_VERSION < 20
+	FCaptureProtocolID BackedUpCaptureType;
+#else
+	FSoftClassPath BackedUpImageCaptureProtocolType;
+#endif
 };
 
-PyObject *py_unreal_engine_in_editor_capture(PyObject * self, PyObject * args)
+PyObject *py_unreal_engine_in_editor_capture(PyObject * self, PyObject * args, PyObject *kwargs)
 {
 	PyObject *py_scene_captures;
 	PyObject *py_callable = nullptr;
-
-	if (!PyArg_ParseTuple(args, "O|O:in_editor_capture", &py_scene_captures, &py_callable))
+	PyObject *py_frame_sink = nullptr;
+	char *frame_format = (char *)"raw";
+	int max_pending_frames = 3;
+	PyObject *py_drop_frames = nullptr;
+
+	char *kwlist[] = {
+		(char *)"captures",
+		(char *)"callable",
+		(char *)"frame_sink",
+		(char *)"frame_format",
+		(char *)"max_pending_frames",
+		(char *)"drop_frames",
+		nullptr };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|OOsiO:in_editor_capture", kwlist,
+		&py_scene_captures, &py_callable, &py_frame_sink, &frame_format, &max_pending_frames, &py_drop_frames))
 	{
 		return nullptr;
 	}
 
+	if (py_callable == Py_None)
+		py_callable = nullptr;
+
+	FPyCaptureFrameSink FrameSink;
+	FrameSink.py_sink = nullptr;
+	FrameSink.bDropFrames = py_drop_frames && PyObject_IsTrue(py_drop_frames);
+	FrameSink.bQueue = false;
+	FrameSink.bAsyncQueue = false;
+	FrameSink.Format = FString(UTF8_TO_TCHAR(frame_format)).ToLower();
+	FrameSink.MaxPendingFrames = max_pending_frames;
+
+	if (py_frame_sink && py_frame_sink != Py_None)
+	{
+#if PY_MAJOR_VERSION >= 3
+		PyObject *py_asyncio = PyImport_ImportModule("asyncio");
+		PyObject *py_asyncio_queue = py_asyncio ? PyObject_GetAttrString(py_asyncio, "Queue") : nullptr;
+		if (py_asyncio_queue)
+		{
+			int is_async_queue = PyObject_IsInstance(py_frame_sink, py_asyncio_queue);
+			FrameSink.bAsyncQueue = is_async_queue > 0;
+		}
+		PyErr_Clear();
+		Py_XDECREF(py_asyncio);
+		Py_XDECREF(py_asyncio_queue);
+#endif
+		FrameSink.bQueue = PyObject_HasAttrString(py_frame_sink, FrameSink.bDropFrames || FrameSink.bAsyncQueue ? "put_nowait" : "put") != 0;
+		if (!FrameSink.bQueue && !PyCallable_Check(py_frame_sink))
+			return PyErr_Format(PyExc_Exception, "frame_sink must be a callable or a queue");
+
+		if (FrameSink.Format != TEXT("raw"))
+		{
+			// check the format now
+			if (!ue_py_new_image_wrapper(frame_format).IsValid())
+				return nullptr;
+		}
+
+		if (max_pending_frames < 1)
+			return PyErr_Format(PyExc_ValueError, "max_pending_frames must be at least 1");
+
+		FrameSink.py_sink = py_frame_sink;
+	}
+
 	TArray<UMovieSceneCapture *> Captures;
 
 	UMovieSceneCapture *capture = ue_py_check_type<UMovieSceneCapture>(py_scene_captures);
@@ -374,8 +758,11 @@ PyObject *py_unreal_engine_in_editor_capture(PyObject * self, PyObject * args)
 		Captures.Add(capture);
 	}
 
+	// released by the capture
+	Py_XINCREF(FrameSink.py_sink);
+
 	Py_BEGIN_ALLOW_THREADS
-		FInEditorMultiCapture::CreateInEditorMultiCapture(Captures, py_callable);
+		FInEditorMultiCapture::CreateInEditorMultiCapture(Captures, py_callable, FrameSink);
 	Py_END_ALLOW_THREADS
 
 		Py_RETURN_NONE;
@@ -10,4 +10,4 @@ PyObject *py_ue_capture_load_from_config(ue_PyUObject *, PyObject *);
 PyObject *py_ue_capture_stop(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_set_level_sequence_asset(ue_PyUObject *, PyObject *);
-PyObject *py_unreal_engine_in_editor_capture(PyObject *, PyObject *);
\ No newline at end of file
+PyObject *py_unreal_engine_in_editor_capture(PyObject *, PyObject *, PyObject *);
\ No newline at end of file
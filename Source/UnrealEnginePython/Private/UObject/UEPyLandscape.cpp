@@ -60,26 +60,31 @@ PyObject* py_ue_landscape_import(ue_PyUObject* self, PyObject* args)
 	int size_y = component_y * quads_per_component + 1;
 
 	if (heightmap_buffer.len < (Py_ssize_t)(size_x * size_y * sizeof(uint16)))
+	{
+		PyBuffer_Release(&heightmap_buffer);
 		return PyErr_Format(PyExc_Exception, "not enough heightmap data, expecting %lu bytes", size_x * size_y * sizeof(uint16));
+	}
 
 	uint16* data = (uint16*)heightmap_buffer.buf;
 
 	TArray<FLandscapeImportLayerInfo> infos;
 
+	// the buffer is held, so it cannot be resized by other threads
+	Py_BEGIN_ALLOW_THREADS;
 #if ENGINE_MINOR_VERSION < 23
 	landscape->Import(FGuid::NewGuid(), 0, 0, size_x - 1, size_y - 1, sections_per_component, section_size, data, nullptr, infos, (ELandscapeImportAlphamapType)layer_type);
 #else
 	TMap<FGuid, TArray<uint16>> HeightDataPerLayers;
 	TArray<uint16> HeightData;
-	for (uint32 i = 0; i < (heightmap_buffer.len / sizeof(uint16)); i++)
-	{
-		HeightData.Add(data[i]);
-	}
-	HeightDataPerLayers.Add(FGuid(), HeightData);
+	HeightData.Append(data, heightmap_buffer.len / sizeof(uint16));
+	HeightDataPerLayers.Add(FGuid(), MoveTemp(HeightData));
 	TMap<FGuid, TArray<FLandscapeImportLayerInfo>> MaterialLayersInfo;
 	MaterialLayersInfo.Add(FGuid(), infos);
 	landscape->Import(FGuid::NewGuid(), 0, 0, size_x - 1, size_y - 1, sections_per_component, section_size, HeightDataPerLayers, nullptr, MaterialLayersInfo, (ELandscapeImportAlphamapType)layer_type);
 #endif
+	Py_END_ALLOW_THREADS;
+
+	PyBuffer_Release(&heightmap_buffer);
 
 	Py_RETURN_NONE;
 }
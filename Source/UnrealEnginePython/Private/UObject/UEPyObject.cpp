@@ -3,7 +3,9 @@
 #include "PythonDelegate.h"
 #include "PythonFunction.h"
 #include "Components/ActorComponent.h"
+#include "Wrappers/UEPyFArrayPropertyView.h"
 #include "Engine/UserDefinedEnum.h"
+#include "UEPyAsyncLoop.h"
 
 #if WITH_EDITOR
 #include "Runtime/AssetRegistry/Public/AssetRegistryModule.h"
@@ -808,6 +810,9 @@ PyObject *py_ue_set_property(ue_PyUObject *self, PyObject * args)
 
 	if (!ue_py_convert_pyobject(property_value, u_property, (uint8 *)self->ue_object, index))
 	{
+		// converters set an error only for specific failures (like resizing an exported array)
+		if (PyErr_Occurred())
+			return nullptr;
 		return PyErr_Format(PyExc_Exception, "unable to set property %s", property_name);
 	}
 
@@ -1181,6 +1186,43 @@ PyObject *py_ue_get_property(ue_PyUObject *self, PyObject * args)
 	return ue_py_convert_property(u_property, (uint8 *)self->ue_object, index);
 }
 
+PyObject *py_ue_get_property_view(ue_PyUObject *self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	char *property_name;
+	int index = 0;
+	if (!PyArg_ParseTuple(args, "s|i:get_property_view", &property_name, &index))
+	{
+		return nullptr;
+	}
+
+	UStruct *u_struct = nullptr;
+
+	if (self->ue_object->IsA<UClass>())
+	{
+		u_struct = (UStruct *)self->ue_object;
+	}
+	else
+	{
+		u_struct = (UStruct *)self->ue_object->GetClass();
+	}
+
+	UProperty *u_property = u_struct->FindPropertyByName(FName(UTF8_TO_TCHAR(property_name)));
+	if (!u_property)
+		return PyErr_Format(PyExc_Exception, "unable to find property %s", property_name);
+
+	UArrayProperty *casted_prop = Cast<UArrayProperty>(u_property);
+	if (!casted_prop)
+		return PyErr_Format(PyExc_Exception, "property %s is not a TArray", property_name);
+
+	if (index < 0 || index >= casted_prop->ArrayDim)
+		return PyErr_Format(PyExc_IndexError, "invalid index %d for property %s", index, property_name);
+
+	return py_ue_new_farray_property_view(self->ue_object, casted_prop, index);
+}
+
 PyObject *py_ue_get_property_array_dim(ue_PyUObject *self, PyObject * args)
 {
 
@@ -1508,7 +1550,8 @@ PyObject *py_ue_bind_event(ue_PyUObject * self, PyObject * args)
 
 	char *event_name;
 	PyObject *py_callable;
-	if (!PyArg_ParseTuple(args, "sO:bind_event", &event_name, &py_callable))
+	PyObject *py_coalesce = nullptr;
+	if (!PyArg_ParseTuple(args, "sO|O:bind_event", &event_name, &py_callable, &py_coalesce))
 	{
 		return NULL;
 	}
@@ -1518,7 +1561,19 @@ PyObject *py_ue_bind_event(ue_PyUObject * self, PyObject * args)
 		return PyErr_Format(PyExc_Exception, "object is not callable");
 	}
 
-	return ue_bind_pyevent(self, FString(event_name), py_callable, true);
+	PyObject *ret = ue_bind_pyevent(self, FString(event_name), py_callable, true);
+	if (!ret)
+		return nullptr;
+
+	if (py_coalesce && PyObject_IsTrue(py_coalesce))
+	{
+		// the most recently bound delegate of the pair
+		UPythonDelegate *py_delegate = FUnrealEnginePythonHouseKeeper::Get()->FindDelegate(self->ue_object, py_callable);
+		if (py_delegate)
+			py_delegate->SetCoalesce(true);
+	}
+
+	return ret;
 }
 
 PyObject *py_ue_unbind_event(ue_PyUObject * self, PyObject * args)
@@ -1540,6 +1595,128 @@ PyObject *py_ue_unbind_event(ue_PyUObject * self, PyObject * args)
 	return ue_unbind_pyevent(self, FString(event_name), py_callable, true);
 }
 
+#if PY_MAJOR_VERSION >= 3
+// self is the (future, uobject, event name) tuple
+static PyObject *py_ue_wait_event_resolver(PyObject *self, PyObject * args);
+static PyObject *py_ue_wait_event_done(PyObject *self, PyObject * args);
+
+static PyMethodDef ue_py_wait_event_resolver_def = { "wait_event_resolver", (PyCFunction)py_ue_wait_event_resolver, METH_VARARGS, "" };
+static PyMethodDef ue_py_wait_event_done_def = { "wait_event_done", (PyCFunction)py_ue_wait_event_done, METH_VARARGS, "" };
+
+// unbinds the resolver and releases its delegate (no-op if already released)
+static void ue_py_wait_event_release(PyObject *py_wait)
+{
+	ue_PyUObject *py_obj = (ue_PyUObject *)PyTuple_GetItem(py_wait, 1);
+	PyObject *py_event_name = PyTuple_GetItem(py_wait, 2);
+
+	if (!ue_is_pyuobject(py_obj) || !py_obj->ue_object || !py_obj->ue_object->IsValidLowLevel())
+		return;
+
+	// same method definition and self, so the same delegate key of the bound callable
+	PyObject *py_callable = PyCFunction_New(&ue_py_wait_event_resolver_def, py_wait);
+	if (!py_callable)
+	{
+		unreal_engine_py_log_error();
+		return;
+	}
+
+	if (FUnrealEnginePythonHouseKeeper::Get()->FindDelegate(py_obj->ue_object, py_callable))
+	{
+		PyObject *ret = ue_unbind_pyevent(py_obj, FString(UTF8_TO_TCHAR(PyUnicode_AsUTF8(py_event_name))), py_callable, false);
+		if (!ret)
+			unreal_engine_py_log_error();
+		Py_XDECREF(ret);
+		FUnrealEnginePythonHouseKeeper::Get()->UntrackDelegate(py_obj->ue_object, py_callable);
+	}
+	Py_DECREF(py_callable);
+}
+
+static PyObject *py_ue_wait_event_resolver(PyObject *self, PyObject * args)
+{
+	PyObject *py_future = PyTuple_GetItem(self, 0);
+
+	PyObject *py_value = Py_None;
+	if (PyTuple_Size(args) == 1)
+		py_value = PyTuple_GetItem(args, 0);
+	else if (PyTuple_Size(args) > 1)
+		py_value = args;
+
+	// keep the self tuple (and the value) alive while unbinding, the delegate could be the last owner
+	Py_INCREF(self);
+	Py_INCREF(py_value);
+	ue_py_wait_event_release(self);
+	py_ue_async_resolve(py_future, py_value);
+	Py_DECREF(py_value);
+	Py_DECREF(self);
+	Py_RETURN_NONE;
+}
+
+// done callback of the future, releases the delegate of cancelled futures
+static PyObject *py_ue_wait_event_done(PyObject *self, PyObject * args)
+{
+	ue_py_wait_event_release(self);
+	Py_RETURN_NONE;
+}
+
+PyObject *py_ue_wait_event(ue_PyUObject * self, PyObject * args)
+{
+	ue_py_check(self);
+
+	char *event_name;
+	if (!PyArg_ParseTuple(args, "s:wait_event", &event_name))
+	{
+		return NULL;
+	}
+
+	PyObject *py_future = py_ue_async_new_future();
+	if (!py_future)
+		return nullptr;
+
+	PyObject *py_self = Py_BuildValue("(OOs)", py_future, self, event_name);
+	if (!py_self)
+	{
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+
+	PyObject *py_callable = PyCFunction_New(&ue_py_wait_event_resolver_def, py_self);
+	if (!py_callable)
+	{
+		Py_DECREF(py_self);
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+
+	PyObject *ret = ue_bind_pyevent(self, FString(UTF8_TO_TCHAR(event_name)), py_callable, true);
+	Py_DECREF(py_callable);
+	if (!ret)
+	{
+		Py_DECREF(py_self);
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+	Py_DECREF(ret);
+
+	PyObject *py_done = PyCFunction_New(&ue_py_wait_event_done_def, py_self);
+	ret = py_done ? PyObject_CallMethod(py_future, (char *)"add_done_callback", (char *)"O", py_done) : nullptr;
+	Py_XDECREF(py_done);
+	if (!ret)
+	{
+		PyObject *type, *value, *traceback;
+		PyErr_Fetch(&type, &value, &traceback);
+		ue_py_wait_event_release(py_self);
+		PyErr_Restore(type, value, traceback);
+		Py_DECREF(py_self);
+		Py_DECREF(py_future);
+		return nullptr;
+	}
+	Py_DECREF(ret);
+	Py_DECREF(py_self);
+
+	return py_future;
+}
+#endif
+
 PyObject *py_ue_delegate_bind_ufunction(ue_PyUObject * self, PyObject * args)
 {
 	ue_py_check(self);
@@ -2124,7 +2301,9 @@ PyObject *py_ue_save_package(ue_PyUObject * self, PyObject * args)
 	// ensure the right flags are applied
 	u_object->SetFlags(RF_Public | RF_Standalone);
 
+	Py_BEGIN_ALLOW_THREADS;
 	package->FullyLoad();
+	Py_END_ALLOW_THREADS;
 	package->MarkPackageDirty();
 
 	if (package->FileName.IsNone())
@@ -2139,7 +2318,12 @@ PyObject *py_ue_save_package(ue_PyUObject * self, PyObject * args)
 		package->FileName = *FPackageName::LongPackageNameToFilename(package->GetPathName(), bIsMap ? FPackageName::GetMapPackageExtension() : FPackageName::GetAssetPackageExtension());
 	}
 
-	if (UPackage::SavePackage(package, u_object, RF_Standalone, *package->FileName.ToString()))
+	bool bSaved = false;
+	Py_BEGIN_ALLOW_THREADS;
+	bSaved = UPackage::SavePackage(package, u_object, RF_Standalone, *package->FileName.ToString());
+	Py_END_ALLOW_THREADS;
+
+	if (bSaved)
 	{
 		FAssetRegistryModule::AssetCreated(u_object);
 		Py_RETURN_UOBJECT(u_object);
@@ -2214,7 +2398,12 @@ PyObject *py_ue_asset_reimport(ue_PyUObject * self, PyObject * args)
 	if (filename)
 		f_filename = FString(UTF8_TO_TCHAR(filename));
 
-	if (FReimportManager::Instance()->Reimport(self->ue_object, ask_for_new_file, show_notification, f_filename))
+	bool bReimported = false;
+	Py_BEGIN_ALLOW_THREADS;
+	bReimported = FReimportManager::Instance()->Reimport(self->ue_object, ask_for_new_file, show_notification, f_filename);
+	Py_END_ALLOW_THREADS;
+
+	if (bReimported)
 	{
 		Py_RETURN_TRUE;
 	}
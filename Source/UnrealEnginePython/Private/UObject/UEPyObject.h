@@ -24,6 +24,7 @@ PyObject *py_ue_properties(ue_PyUObject *, PyObject *);
 PyObject *py_ue_call(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_property(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_property_array_dim(ue_PyUObject *, PyObject *);
+PyObject *py_ue_get_property_view(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_uproperty(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_inner(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_key_prop(ue_PyUObject *, PyObject *);
@@ -52,6 +53,9 @@ PyObject *py_ue_enum_user_defined_names(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_bind_event(ue_PyUObject *, PyObject *);
 PyObject *py_ue_unbind_event(ue_PyUObject *, PyObject *);
+#if PY_MAJOR_VERSION >= 3
+PyObject *py_ue_wait_event(ue_PyUObject *, PyObject *);
+#endif
 PyObject *py_ue_add_function(ue_PyUObject *, PyObject *);
 PyObject *py_ue_add_property(ue_PyUObject *, PyObject *);
 
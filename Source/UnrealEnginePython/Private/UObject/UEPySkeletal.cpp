@@ -1065,7 +1065,10 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 	build_settings.bComputeTangents = (py_compute_tangents && PyObject_IsTrue(py_compute_tangents));
 	build_settings.bRemoveDegenerateTriangles = true;
 
-	bool success = MeshUtilities.BuildSkeletalMesh(lod_model, mesh->RefSkeleton, influences, wedges, faces, points, points_to_map, build_settings);
+	bool success = false;
+	Py_BEGIN_ALLOW_THREADS;
+	success = MeshUtilities.BuildSkeletalMesh(lod_model, mesh->RefSkeleton, influences, wedges, faces, points, points_to_map, build_settings);
+	Py_END_ALLOW_THREADS;
 
 	if (!success)
 	{
@@ -1079,6 +1082,7 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 	}
 #endif
 
+	Py_BEGIN_ALLOW_THREADS;
 	mesh->CalculateRequiredBones(LODModel, mesh->RefSkeleton, nullptr);
 	mesh->CalculateInvRefMatrices();
 
@@ -1091,8 +1095,10 @@ PyObject *py_ue_skeletal_mesh_build_lod(ue_PyUObject *self, PyObject * args, PyO
 	mesh->Skeleton->PostEditChange();
 	mesh->Skeleton->MarkPackageDirty();
 
+	// rebuilds the render resources
 	mesh->PostEditChange();
 	mesh->MarkPackageDirty();
+	Py_END_ALLOW_THREADS;
 
 	Py_RETURN_NONE;
 }
@@ -35,7 +35,12 @@ static PyObject *generate_kdop(ue_PyUObject *self, const FVector *directions, ui
 		DirArray.Add(directions[i]);
 	}
 
-	if (GenerateKDopAsSimpleCollision(mesh, DirArray) == INDEX_NONE)
+	int32 PrimIndex = INDEX_NONE;
+	Py_BEGIN_ALLOW_THREADS;
+	PrimIndex = GenerateKDopAsSimpleCollision(mesh, DirArray);
+	Py_END_ALLOW_THREADS;
+
+	if (PrimIndex == INDEX_NONE)
 	{
 		return PyErr_Format(PyExc_Exception, "unable to generate KDop vectors");
 	}
@@ -90,7 +95,9 @@ PyObject *py_ue_static_mesh_build(ue_PyUObject *self, PyObject * args)
 #if ENGINE_MINOR_VERSION > 13
 	mesh->ImportVersion = EImportStaticMeshVersion::LastVersion;
 #endif
+	Py_BEGIN_ALLOW_THREADS;
 	mesh->Build();
+	Py_END_ALLOW_THREADS;
 
 	Py_RETURN_NONE;
 }
@@ -127,7 +134,9 @@ PyObject *py_ue_static_mesh_get_raw_mesh(ue_PyUObject *self, PyObject * args)
 	if (lod_index < 0 || lod_index >= mesh->SourceModels.Num())
 		return PyErr_Format(PyExc_Exception, "invalid LOD index");
 
+	Py_BEGIN_ALLOW_THREADS;
 	mesh->SourceModels[lod_index].RawMeshBulkData->LoadRawMesh(raw_mesh);
+	Py_END_ALLOW_THREADS;
 
 	return py_ue_new_fraw_mesh(raw_mesh);
 }
@@ -145,7 +154,13 @@ PyObject *py_ue_static_mesh_import_lod(ue_PyUObject *self, PyObject * args)
 	if (!mesh)
 		return PyErr_Format(PyExc_Exception, "uobject is not a UStaticMesh");
 
-	if (FbxMeshUtils::ImportStaticMeshLOD(mesh, FString(UTF8_TO_TCHAR(filename)), lod_level))
+	FString Filename = UTF8_TO_TCHAR(filename);
+	bool bImported = false;
+	Py_BEGIN_ALLOW_THREADS;
+	bImported = FbxMeshUtils::ImportStaticMeshLOD(mesh, Filename, lod_level);
+	Py_END_ALLOW_THREADS;
+
+	if (bImported)
 	{
 		Py_RETURN_TRUE;
 	}
@@ -4,6 +4,11 @@
 #include "Runtime/Engine/Classes/Engine/Texture.h"
 #include "Engine/TextureRenderTarget2D.h"
 #include "Engine/Texture2D.h"
+#include "Wrappers/UEPyFTextureMipLock.h"
+#include "Wrappers/UEPyFObjectThumbnail.h"
+#include "Runtime/ImageWrapper/Public/IImageWrapperModule.h"
+#include "Runtime/Core/Public/Async/ParallelFor.h"
+#include "Runtime/Core/Public/Misc/FileHelper.h"
 
 PyObject *py_ue_texture_update_resource(ue_PyUObject *self, PyObject * args)
 {
@@ -172,6 +177,42 @@ PyObject *py_ue_texture_set_source_data(ue_PyUObject *self, PyObject * args)
 }
 #endif
 
+PyObject *py_ue_texture_lock_mip(ue_PyUObject *self, PyObject * args)
+{
+
+	ue_py_check(self);
+
+	int mipmap = 0;
+	PyObject *py_source = nullptr;
+	PyObject *py_readonly = nullptr;
+
+	if (!PyArg_ParseTuple(args, "|iOO:texture_lock_mip", &mipmap, &py_source, &py_readonly))
+	{
+		return nullptr;
+	}
+
+	UTexture2D *tex = ue_py_check_type<UTexture2D>(self);
+	if (!tex)
+		return PyErr_Format(PyExc_Exception, "object is not a Texture2D");
+
+	PyObject *py_lock = py_ue_new_ftexture_mip_lock();
+	ue_PyFTextureMipLock *lock = (ue_PyFTextureMipLock *)py_lock;
+	lock->single = true;
+
+	if (!py_ue_ftexture_mip_lock_add(lock, tex, mipmap, py_source && PyObject_IsTrue(py_source), py_readonly && PyObject_IsTrue(py_readonly)))
+	{
+		Py_DECREF(py_lock);
+		return nullptr;
+	}
+
+	return py_lock;
+}
+
+PyObject *py_unreal_engine_texture_lock_batch(PyObject * self, PyObject * args)
+{
+	return py_ue_new_ftexture_mip_lock();
+}
+
 PyObject *py_ue_render_target_get_data(ue_PyUObject *self, PyObject * args)
 {
 
@@ -336,7 +377,7 @@ PyObject *py_unreal_engine_compress_image_array(PyObject * self, PyObject * args
 	uint8 *buf = (uint8 *)py_buf.buf;
 	for (int32 i = 0; i < py_buf.len; i += 4)
 	{
-		colors.Add(FColor(buf[i], buf[1 + 1], buf[i + 2], buf[i + 3]));
+		colors.Add(FColor(buf[i], buf[i + 1], buf[i + 2], buf[i + 3]));
 	}
 
 	PyBuffer_Release(&py_buf);
@@ -350,6 +391,253 @@ PyObject *py_unreal_engine_compress_image_array(PyObject * self, PyObject * args
 	return PyBytes_FromStringAndSize((char *)output.GetData(), output.Num());
 }
 
+#if ENGINE_MINOR_VERSION >= 18
+typedef EImageFormat FPyImageFormat;
+#else
+typedef EImageFormat::Type FPyImageFormat;
+#endif
+
+TSharedPtr<IImageWrapper> ue_py_new_image_wrapper(const char *format)
+{
+	FString image_format = UTF8_TO_TCHAR(format);
+	FPyImageFormat compression_format = EImageFormat::PNG;
+	if (image_format.Equals(TEXT("jpg"), ESearchCase::IgnoreCase) || image_format.Equals(TEXT("jpeg"), ESearchCase::IgnoreCase))
+	{
+		compression_format = EImageFormat::JPEG;
+	}
+	else if (!image_format.Equals(TEXT("png"), ESearchCase::IgnoreCase))
+	{
+		PyErr_Format(PyExc_ValueError, "unsupported image format %s (png or jpeg)", format);
+		return nullptr;
+	}
+
+	IImageWrapperModule &ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(compression_format);
+	if (!ImageWrapper.IsValid())
+		PyErr_Format(PyExc_Exception, "unable to create image wrapper for %s", format);
+	return ImageWrapper;
+}
+
+struct FPyImageCompressionJob
+{
+	int32 Width;
+	int32 Height;
+	const uint8 *Data;
+	int64 Size;
+	// bytes read from Data (width * height * 4)
+	int32 RawSize;
+	bool bRGBA;
+	Py_buffer py_buf;
+	bool bHasBuffer;
+	// the thumbnail owning Data, kept alive while the GIL is released
+	PyObject *py_source;
+	TSharedPtr<IImageWrapper> ImageWrapper;
+	// if empty the compressed data is kept in the image wrapper
+	FString Path;
+	const TArray<uint8> *Compressed;
+	bool bSucceeded;
+};
+
+PyObject *py_unreal_engine_compress_images(PyObject * self, PyObject * args, PyObject *kwargs)
+{
+	PyObject *py_jobs;
+	char *format = (char *)"png";
+	int quality = 0;
+	PyObject *py_paths = nullptr;
+	char *pixel_format = (char *)"BGRA";
+
+	char *kwlist[] = {
+		(char *)"jobs",
+		(char *)"format",
+		(char *)"quality",
+		(char *)"paths",
+		(char *)"pixel_format",
+		nullptr };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "O|siOs:compress_images", kwlist, &py_jobs, &format, &quality, &py_paths, &pixel_format))
+	{
+		return nullptr;
+	}
+
+	FString raw_format = UTF8_TO_TCHAR(pixel_format);
+	bool rgba = raw_format.Equals(TEXT("RGBA"), ESearchCase::IgnoreCase);
+	if (!rgba && !raw_format.Equals(TEXT("BGRA"), ESearchCase::IgnoreCase))
+		return PyErr_Format(PyExc_ValueError, "unsupported pixel format %s (BGRA or RGBA)", pixel_format);
+
+	if (py_paths == Py_None)
+		py_paths = nullptr;
+
+	PyObject *py_jobs_seq = PySequence_Fast(py_jobs, "jobs must be a sequence");
+	if (!py_jobs_seq)
+		return nullptr;
+
+	PyObject *py_paths_seq = nullptr;
+	if (py_paths)
+	{
+		py_paths_seq = PySequence_Fast(py_paths, "paths must be a sequence");
+		if (!py_paths_seq)
+		{
+			Py_DECREF(py_jobs_seq);
+			return nullptr;
+		}
+		if (PySequence_Fast_GET_SIZE(py_paths_seq) != PySequence_Fast_GET_SIZE(py_jobs_seq))
+		{
+			Py_DECREF(py_jobs_seq);
+			Py_DECREF(py_paths_seq);
+			return PyErr_Format(PyExc_ValueError, "the number of paths does not match the number of jobs");
+		}
+	}
+
+	Py_ssize_t jobs_num = PySequence_Fast_GET_SIZE(py_jobs_seq);
+	TArray<FPyImageCompressionJob> jobs;
+	jobs.AddZeroed(jobs_num);
+
+	bool failed = false;
+	for (Py_ssize_t i = 0; i < jobs_num; i++)
+	{
+		FPyImageCompressionJob &job = jobs[i];
+		PyObject *py_item = PySequence_Fast_GET_ITEM(py_jobs_seq, i);
+
+		// thumbnails are always BGRA
+		if (ue_PyFObjectThumbnail *py_thumbnail = py_ue_is_fobject_thumbnail(py_item))
+		{
+			const TArray<uint8> &data = py_thumbnail->object_thumbnail.GetUncompressedImageData();
+			job.Width = py_thumbnail->object_thumbnail.GetImageWidth();
+			job.Height = py_thumbnail->object_thumbnail.GetImageHeight();
+			job.Data = data.GetData();
+			job.Size = data.Num();
+			job.bRGBA = false;
+			Py_INCREF(py_item);
+			job.py_source = py_item;
+		}
+		else
+		{
+			if (!PyTuple_Check(py_item))
+			{
+				PyErr_Format(PyExc_TypeError, "job %d is not a (width, height, buffer) tuple or an FObjectThumbnail", (int)i);
+				failed = true;
+				break;
+			}
+			PyObject *py_buffer;
+			if (!PyArg_ParseTuple(py_item, "iiO", &job.Width, &job.Height, &py_buffer))
+			{
+				failed = true;
+				break;
+			}
+			if (PyObject_GetBuffer(py_buffer, &job.py_buf, PyBUF_SIMPLE) < 0)
+			{
+				failed = true;
+				break;
+			}
+			job.bHasBuffer = true;
+			job.Data = (const uint8 *)job.py_buf.buf;
+			job.Size = (int64)job.py_buf.len;
+			job.bRGBA = rgba;
+		}
+
+		int64 raw_size = (int64)job.Width * (int64)job.Height * 4;
+		if (job.Width <= 0 || job.Height <= 0 || raw_size > job.Size || raw_size > MAX_int32)
+		{
+			PyErr_Format(PyExc_Exception, "invalid image data for job %d", (int)i);
+			failed = true;
+			break;
+		}
+		job.RawSize = (int32)raw_size;
+
+		if (py_paths_seq)
+		{
+			PyObject *py_path = PyObject_Str(PySequence_Fast_GET_ITEM(py_paths_seq, i));
+			if (!py_path)
+			{
+				failed = true;
+				break;
+			}
+			job.Path = UTF8_TO_TCHAR(UEPyUnicode_AsUTF8(py_path));
+			Py_DECREF(py_path);
+		}
+
+		// wrappers are created here, the module is not accessed by the TaskGraph threads
+		job.ImageWrapper = ue_py_new_image_wrapper(format);
+		if (!job.ImageWrapper.IsValid())
+		{
+			failed = true;
+			break;
+		}
+	}
+
+	if (!failed)
+	{
+		bool to_disk = py_paths_seq != nullptr;
+
+		Py_BEGIN_ALLOW_THREADS;
+		ParallelFor(jobs.Num(), [&jobs, quality, to_disk](int32 Index)
+		{
+			FPyImageCompressionJob &job = jobs[Index];
+			if (!job.ImageWrapper.IsValid())
+				return;
+			if (!job.ImageWrapper->SetRaw(job.Data, job.RawSize, job.Width, job.Height, job.bRGBA ? ERGBFormat::RGBA : ERGBFormat::BGRA, 8))
+				return;
+			job.Compressed = &job.ImageWrapper->GetCompressed(quality);
+			if (to_disk)
+			{
+				job.bSucceeded = FFileHelper::SaveArrayToFile(*job.Compressed, *job.Path);
+				// do not keep every compressed image in memory
+				job.Compressed = nullptr;
+				job.ImageWrapper.Reset();
+			}
+			else
+			{
+				job.bSucceeded = job.Compressed->Num() > 0;
+			}
+		});
+		Py_END_ALLOW_THREADS;
+	}
+
+	PyObject *py_results = nullptr;
+	if (!failed)
+	{
+		py_results = PyList_New(jobs.Num());
+	}
+	if (py_results)
+	{
+		for (int32 i = 0; i < jobs.Num(); i++)
+		{
+			FPyImageCompressionJob &job = jobs[i];
+			PyObject *py_result = nullptr;
+			if (py_paths_seq)
+			{
+				py_result = PyBool_FromLong(job.bSucceeded);
+			}
+			else if (job.bSucceeded)
+			{
+				py_result = PyBytes_FromStringAndSize((const char *)job.Compressed->GetData(), job.Compressed->Num());
+			}
+			else
+			{
+				Py_INCREF(Py_None);
+				py_result = Py_None;
+			}
+			if (!py_result)
+			{
+				Py_CLEAR(py_results);
+				break;
+			}
+			PyList_SetItem(py_results, i, py_result);
+		}
+	}
+
+	for (FPyImageCompressionJob &job : jobs)
+	{
+		if (job.bHasBuffer)
+			PyBuffer_Release(&job.py_buf);
+		Py_XDECREF(job.py_source);
+	}
+
+	Py_DECREF(py_jobs_seq);
+	Py_XDECREF(py_paths_seq);
+	return py_results;
+}
+
 PyObject *py_unreal_engine_create_checkerboard_texture(PyObject * self, PyObject * args)
 {
 	PyObject *py_color_one;
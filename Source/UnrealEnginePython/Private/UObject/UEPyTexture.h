@@ -4,17 +4,24 @@
 
 #include "UEPyModule.h"
 
+#include "Runtime/ImageWrapper/Public/IImageWrapper.h"
+
 PyObject *py_ue_texture_get_data(ue_PyUObject *, PyObject *);
 PyObject *py_ue_render_target_get_data(ue_PyUObject *, PyObject *);
 PyObject *py_ue_render_target_get_data_to_buffer(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_texture_set_data(ue_PyUObject *, PyObject *);
+PyObject *py_ue_texture_lock_mip(ue_PyUObject *, PyObject *);
+PyObject *py_unreal_engine_texture_lock_batch(PyObject *, PyObject *);
 PyObject *py_ue_texture_get_width(ue_PyUObject *, PyObject *);
 PyObject *py_ue_texture_get_height(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_texture_has_alpha_channel(ue_PyUObject *, PyObject *);
 
 PyObject *py_unreal_engine_compress_image_array(PyObject *, PyObject *);
+PyObject *py_unreal_engine_compress_images(PyObject *, PyObject *, PyObject *);
+// 'png' or 'jpeg', returns an invalid pointer (with python error set) for unsupported formats
+TSharedPtr<IImageWrapper> ue_py_new_image_wrapper(const char *);
 PyObject *py_unreal_engine_create_checkerboard_texture(PyObject *, PyObject *);
 
 PyObject *py_unreal_engine_create_transient_texture(PyObject *, PyObject *);
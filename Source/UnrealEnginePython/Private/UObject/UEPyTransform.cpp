@@ -2,6 +2,9 @@
 
 #include "GameFramework/Actor.h"
 #include "Wrappers/UEPyFHitResult.h"
+#include "Wrappers/UEPyFVectorArray.h"
+#include "Wrappers/UEPyFRotatorArray.h"
+#include "Wrappers/UEPyFTransformArray.h"
 
 static bool check_vector_args(PyObject *args, FVector &vec, bool &sweep, bool &teleport_physics)
 {
@@ -694,3 +697,254 @@ PyObject *py_ue_set_relative_scale(ue_PyUObject *self, PyObject * args)
 	}
 	return PyErr_Format(PyExc_Exception, "uobject is not a USceneComponent");
 }
+
+// batch versions of the actor transform functions, taking a sequence of actors (or components) and a float32 buffer
+
+static bool ue_py_actors_arg(PyObject *py_actors, TArray<AActor *> &actors)
+{
+	PyObject *py_fast = PySequence_Fast(py_actors, "argument is not a sequence of actors or components");
+	if (!py_fast)
+		return false;
+
+	Py_ssize_t len = PySequence_Fast_GET_SIZE(py_fast);
+	PyObject **py_items = PySequence_Fast_ITEMS(py_fast);
+	FUnrealEnginePythonHouseKeeper *HouseKeeper = FUnrealEnginePythonHouseKeeper::Get();
+
+	actors.Reserve(len);
+	for (Py_ssize_t i = 0; i < len; i++)
+	{
+		ue_PyUObject *py_obj = ue_is_pyuobject(py_items[i]);
+		if (!py_obj || !HouseKeeper->IsValidPyUObject(py_obj))
+		{
+			Py_DECREF(py_fast);
+			PyErr_Format(PyExc_Exception, "item %d is not a valid uobject", (int)i);
+			return false;
+		}
+		AActor *actor = ue_get_actor(py_obj);
+		if (!actor)
+		{
+			Py_DECREF(py_fast);
+			PyErr_Format(PyExc_Exception, "item %d is not an actor or a component", (int)i);
+			return false;
+		}
+		actors.Add(actor);
+	}
+
+	Py_DECREF(py_fast);
+	return true;
+}
+
+// on success the buffer is held and must be released by the caller
+static bool ue_py_actors_buffer_arg(PyObject *py_buffer, int32 components, int32 num, Py_buffer *view)
+{
+	Py_ssize_t records = py_ue_float_records_from_buffer(py_buffer, components, view);
+	if (records < 0)
+	{
+		PyErr_Format(PyExc_TypeError, "argument is not a contiguous float32 buffer with (len, %d) shape", components);
+		return false;
+	}
+	if (records != num)
+	{
+		PyBuffer_Release(view);
+		PyErr_Format(PyExc_ValueError, "buffer contains %d items, expected %d", (int)records, num);
+		return false;
+	}
+	return true;
+}
+
+PyObject *py_unreal_engine_get_actors_locations(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	if (!PyArg_ParseTuple(args, "O:get_actors_locations", &py_actors))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	ue_PyFVectorArray *py_vecs = (ue_PyFVectorArray *)py_ue_new_fvector_array(actors.Num());
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		py_vecs->vecs[i] = actors[i]->GetActorLocation();
+	}
+	return (PyObject *)py_vecs;
+}
+
+PyObject *py_unreal_engine_get_actors_rotations(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	if (!PyArg_ParseTuple(args, "O:get_actors_rotations", &py_actors))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	ue_PyFRotatorArray *py_rots = (ue_PyFRotatorArray *)py_ue_new_frotator_array(actors.Num());
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		py_rots->rots[i] = actors[i]->GetActorRotation();
+	}
+	return (PyObject *)py_rots;
+}
+
+PyObject *py_unreal_engine_get_actors_scales(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	if (!PyArg_ParseTuple(args, "O:get_actors_scales", &py_actors))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	ue_PyFVectorArray *py_vecs = (ue_PyFVectorArray *)py_ue_new_fvector_array(actors.Num());
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		py_vecs->vecs[i] = actors[i]->GetActorScale3D();
+	}
+	return (PyObject *)py_vecs;
+}
+
+PyObject *py_unreal_engine_get_actors_transforms(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	if (!PyArg_ParseTuple(args, "O:get_actors_transforms", &py_actors))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	ue_PyFTransformArray *py_transforms = (ue_PyFTransformArray *)py_ue_new_ftransform_array(actors.Num());
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		ue_py_transform_to_transform_record(actors[i]->GetActorTransform(), py_transforms->transforms[i]);
+	}
+	return (PyObject *)py_transforms;
+}
+
+PyObject *py_unreal_engine_set_actors_locations(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	PyObject *py_buffer;
+	PyObject *py_sweep = nullptr;
+	PyObject *py_teleport_physics = nullptr;
+	if (!PyArg_ParseTuple(args, "OO|OO:set_actors_locations", &py_actors, &py_buffer, &py_sweep, &py_teleport_physics))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	Py_buffer view;
+	if (!ue_py_actors_buffer_arg(py_buffer, 3, actors.Num(), &view))
+		return nullptr;
+
+	bool sweep = (py_sweep && PyObject_IsTrue(py_sweep));
+	ETeleportType teleport = (py_teleport_physics && PyObject_IsTrue(py_teleport_physics)) ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+	const FVector *vecs = (const FVector *)view.buf;
+	PyObject *py_hits = sweep ? PyList_New(actors.Num()) : nullptr;
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		FHitResult hit;
+		actors[i]->SetActorLocation(vecs[i], sweep, sweep ? &hit : nullptr, teleport);
+		if (py_hits)
+			PyList_SET_ITEM(py_hits, i, py_ue_new_fhitresult(hit));
+	}
+	PyBuffer_Release(&view);
+
+	if (py_hits)
+		return py_hits;
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_set_actors_rotations(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	PyObject *py_buffer;
+	PyObject *py_teleport_physics = nullptr;
+	if (!PyArg_ParseTuple(args, "OO|O:set_actors_rotations", &py_actors, &py_buffer, &py_teleport_physics))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	Py_buffer view;
+	if (!ue_py_actors_buffer_arg(py_buffer, 3, actors.Num(), &view))
+		return nullptr;
+
+	ETeleportType teleport = (py_teleport_physics && PyObject_IsTrue(py_teleport_physics)) ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+	const FRotator *rots = (const FRotator *)view.buf;
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		actors[i]->SetActorRotation(rots[i], teleport);
+	}
+	PyBuffer_Release(&view);
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_set_actors_scales(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	PyObject *py_buffer;
+	if (!PyArg_ParseTuple(args, "OO:set_actors_scales", &py_actors, &py_buffer))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	Py_buffer view;
+	if (!ue_py_actors_buffer_arg(py_buffer, 3, actors.Num(), &view))
+		return nullptr;
+
+	const FVector *vecs = (const FVector *)view.buf;
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		actors[i]->SetActorScale3D(vecs[i]);
+	}
+	PyBuffer_Release(&view);
+
+	Py_RETURN_NONE;
+}
+
+PyObject *py_unreal_engine_set_actors_transforms(PyObject * self, PyObject * args)
+{
+	PyObject *py_actors;
+	PyObject *py_buffer;
+	PyObject *py_sweep = nullptr;
+	PyObject *py_teleport_physics = nullptr;
+	if (!PyArg_ParseTuple(args, "OO|OO:set_actors_transforms", &py_actors, &py_buffer, &py_sweep, &py_teleport_physics))
+		return nullptr;
+
+	TArray<AActor *> actors;
+	if (!ue_py_actors_arg(py_actors, actors))
+		return nullptr;
+
+	Py_buffer view;
+	if (!ue_py_actors_buffer_arg(py_buffer, 10, actors.Num(), &view))
+		return nullptr;
+
+	bool sweep = (py_sweep && PyObject_IsTrue(py_sweep));
+	ETeleportType teleport = (py_teleport_physics && PyObject_IsTrue(py_teleport_physics)) ? ETeleportType::TeleportPhysics : ETeleportType::None;
+
+	const FPyTransformRecord *records = (const FPyTransformRecord *)view.buf;
+	PyObject *py_hits = sweep ? PyList_New(actors.Num()) : nullptr;
+	for (int32 i = 0; i < actors.Num(); i++)
+	{
+		FHitResult hit;
+		actors[i]->SetActorTransform(ue_py_transform_record_to_transform(records[i]), sweep, sweep ? &hit : nullptr, teleport);
+		if (py_hits)
+			PyList_SET_ITEM(py_hits, i, py_ue_new_fhitresult(hit));
+	}
+	PyBuffer_Release(&view);
+
+	if (py_hits)
+		return py_hits;
+	Py_RETURN_NONE;
+}
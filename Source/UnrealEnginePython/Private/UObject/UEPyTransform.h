@@ -47,4 +47,13 @@ PyObject *py_ue_set_relative_transform(ue_PyUObject *, PyObject *);
 
 PyObject *py_ue_get_forward_vector(ue_PyUObject *, PyObject *);
 PyObject *py_ue_get_up_vector(ue_PyUObject *, PyObject *);
-PyObject *py_ue_get_right_vector(ue_PyUObject *, PyObject *);
\ No newline at end of file
+PyObject *py_ue_get_right_vector(ue_PyUObject *, PyObject *);
+
+PyObject *py_unreal_engine_get_actors_locations(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_actors_rotations(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_actors_scales(PyObject *, PyObject *);
+PyObject *py_unreal_engine_get_actors_transforms(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_actors_locations(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_actors_rotations(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_actors_scales(PyObject *, PyObject *);
+PyObject *py_unreal_engine_set_actors_transforms(PyObject *, PyObject *);
@@ -4,6 +4,7 @@
 #include "EngineUtils.h"
 #include "Kismet/GameplayStatics.h"
 #include "Runtime/CoreUObject/Public/UObject/UObjectIterator.h"
+#include "Wrappers/UEPyFObjectIterator.h"
 #if WITH_EDITOR
 #include "Editor/UnrealEd/Public/EditorActorFolders.h"
 #endif
@@ -152,6 +153,142 @@ PyObject *py_ue_all_actors(ue_PyUObject * self, PyObject * args)
 	return ret;
 }
 
+PyObject *py_ue_iter_objects(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
+{
+
+	ue_py_check(self);
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	FPyObjectIteratorFilter filter;
+	if (!py_ue_fobject_iterator_filter_args(args, kwargs, "|OzKK:iter_objects", filter))
+		return nullptr;
+
+	filter.World = world;
+	filter.bFilterWorld = true;
+
+	return py_ue_new_fobject_iterator(filter, false);
+}
+
+PyObject *py_ue_iter_actors(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
+{
+
+	ue_py_check(self);
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	FPyObjectIteratorFilter filter;
+	if (!py_ue_fobject_iterator_filter_args(args, kwargs, "|OzKK:iter_actors", filter))
+		return nullptr;
+
+	filter.World = world;
+
+	return py_ue_new_fobject_iterator(filter, true);
+}
+
+PyObject *py_ue_query_actors(ue_PyUObject * self, PyObject * args, PyObject *kwargs)
+{
+
+	ue_py_check(self);
+
+	UWorld *world = ue_get_uworld(self);
+	if (!world)
+		return PyErr_Format(PyExc_Exception, "unable to retrieve UWorld from uobject");
+
+	PyObject *py_class = nullptr;
+	PyObject *py_component_class = nullptr;
+	char *tag = nullptr;
+	PyObject *py_box = nullptr;
+	PyObject *py_sphere = nullptr;
+	PyObject *py_where = nullptr;
+
+	static char *kw_names[] = { (char *)"uclass", (char *)"component", (char *)"tag", (char *)"box", (char *)"sphere", (char *)"where", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, "|OOzOOO:query_actors", kw_names, &py_class, &py_component_class, &tag, &py_box, &py_sphere, &py_where))
+	{
+		return nullptr;
+	}
+
+	FPyObjectIteratorFilter filter;
+	// the class hash is used even without an explicit class
+	filter.Class = AActor::StaticClass();
+	filter.World = world;
+	filter.bFilterWorld = true;
+
+	if (py_class && py_class != Py_None)
+	{
+		UClass *u_class = ue_py_check_type<UClass>(py_class);
+		if (!u_class || !u_class->IsChildOf<AActor>())
+			return PyErr_Format(PyExc_TypeError, "uclass is not an Actor class");
+		filter.Class = u_class;
+	}
+
+	if (py_component_class && py_component_class != Py_None)
+	{
+		UClass *u_class = ue_py_check_type<UClass>(py_component_class);
+		if (!u_class || !u_class->IsChildOf<UActorComponent>())
+			return PyErr_Format(PyExc_TypeError, "component is not an ActorComponent class");
+		filter.ComponentClass = u_class;
+	}
+
+	if (tag)
+		filter.Tag = FName(UTF8_TO_TCHAR(tag));
+
+	if (py_box && py_box != Py_None)
+	{
+		PyObject *py_min = nullptr;
+		PyObject *py_max = nullptr;
+		if (!PyArg_ParseTuple(py_box, "OO", &py_min, &py_max) || !py_ue_is_fvector(py_min) || !py_ue_is_fvector(py_max))
+		{
+			PyErr_Clear();
+			return PyErr_Format(PyExc_TypeError, "box must be a (FVector, FVector) tuple");
+		}
+		filter.Box = FBox(py_ue_is_fvector(py_min)->vec, py_ue_is_fvector(py_max)->vec);
+		filter.bFilterBox = true;
+	}
+
+	if (py_sphere && py_sphere != Py_None)
+	{
+		PyObject *py_center = nullptr;
+		float radius = 0;
+		if (!PyArg_ParseTuple(py_sphere, "Of", &py_center, &radius) || !py_ue_is_fvector(py_center))
+		{
+			PyErr_Clear();
+			return PyErr_Format(PyExc_TypeError, "sphere must be a (FVector, radius) tuple");
+		}
+		filter.SphereCenter = py_ue_is_fvector(py_center)->vec;
+		filter.SphereRadiusSquared = radius * radius;
+		filter.bFilterSphere = true;
+	}
+
+	if (py_where && py_where != Py_None)
+	{
+		if (!PyDict_Check(py_where))
+			return PyErr_Format(PyExc_TypeError, "where must be a dictionary");
+		PyObject *py_key = nullptr;
+		PyObject *py_value = nullptr;
+		Py_ssize_t pos = 0;
+		while (PyDict_Next(py_where, &pos, &py_key, &py_value))
+		{
+			const char *name = UEPyUnicode_AsUTF8(py_key);
+			if (!name)
+				return PyErr_Format(PyExc_TypeError, "where keys must be property names");
+			filter.Properties.Add(TPair<FName, PyObject *>(FName(UTF8_TO_TCHAR(name)), py_value));
+		}
+	}
+
+	PyObject *py_iterator = py_ue_new_fobject_iterator(filter, false);
+	if (!py_iterator)
+		return nullptr;
+	PyObject *ret = PySequence_List(py_iterator);
+	Py_DECREF(py_iterator);
+	return ret;
+}
+
 PyObject *py_ue_find_object(ue_PyUObject *self, PyObject * args)
 {
 
@@ -2,6 +2,9 @@
 
 #include "UnrealEnginePython.h"
 #include "UEPyModule.h"
+#include "UEPyWrapperFreeList.h"
+#include "UEPyInterpreterPool.h"
+#include "UEPyAsyncLoop.h"
 #include "PythonBlueprintFunctionLibrary.h"
 #include "HAL/IConsoleManager.h"
 #include "HAL/PlatformFilemanager.h"
@@ -333,6 +336,16 @@ void FUnrealEnginePythonModule::StartupModule()
 		IniValue.ParseIntoArray(ImportModules, separators, 3);
 	}
 
+	bool bIncrementalGC = false;
+	if (GConfig->GetBool(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("IncrementalGC"), bIncrementalGC, GEngineIni) && bIncrementalGC)
+	{
+		float IncrementalGCBudget = 1;
+		int32 IncrementalGCMaxEntries = 4096;
+		GConfig->GetFloat(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("IncrementalGCBudget"), IncrementalGCBudget, GEngineIni);
+		GConfig->GetInt(UTF8_TO_TCHAR("Python"), UTF8_TO_TCHAR("IncrementalGCMaxEntries"), IncrementalGCMaxEntries, GEngineIni);
+		FUnrealEnginePythonHouseKeeper::Get()->SetIncrementalGC(true, IncrementalGCBudget, IncrementalGCMaxEntries);
+	}
+
 	FString ProjectScriptsPath = FPaths::Combine(*PROJECT_CONTENT_DIR, UTF8_TO_TCHAR("Scripts"));
 	if (!FPaths::DirectoryExists(ProjectScriptsPath))
 	{
@@ -542,9 +555,25 @@ void FUnrealEnginePythonModule::ShutdownModule()
 	UE_LOG(LogPython, Log, TEXT("Goodbye Python"));
 	if (!BrutalFinalize)
 	{
+#if PY_MAJOR_VERSION >= 3
+		// sub-interpreters must be destroyed by their threads
+		ue_python_stop_interpreter_pool();
+#endif
 		PyGILState_Ensure();
+#if PY_MAJOR_VERSION >= 3
+		// the ticker must not step the loop of a finalized interpreter
+		ue_python_shutdown_async_loop(true);
+#endif
+		// cached wrappers must go back to the python allocator before finalizing it
+		py_unreal_engine_clear_wrapper_freelists(nullptr, nullptr);
 		Py_Finalize();
 	}
+#if PY_MAJOR_VERSION >= 3
+	else
+	{
+		ue_python_shutdown_async_loop(false);
+	}
+#endif
 }
 
 void FUnrealEnginePythonModule::RunString(char *str)
@@ -0,0 +1,339 @@
+#include "UEPyFArrayPropertyView.h"
+
+struct FPyArrayStructFormat
+{
+	UScriptStruct *Struct;
+	FPyArrayItemFormat Format;
+};
+
+static void ue_py_add_struct_format(TArray<FPyArrayStructFormat> &formats, UScriptStruct *u_struct, const char *format, Py_ssize_t item_size, int32 components)
+{
+	FPyArrayStructFormat StructFormat;
+	StructFormat.Struct = u_struct;
+	StructFormat.Format.Format = format;
+	StructFormat.Format.ItemSize = item_size;
+	StructFormat.Format.Components = components;
+	formats.Add(StructFormat);
+}
+
+static const TArray<FPyArrayStructFormat> &ue_py_get_struct_formats()
+{
+	static TArray<FPyArrayStructFormat> formats;
+	if (formats.Num() == 0)
+	{
+		ue_py_add_struct_format(formats, TBaseStructure<FVector>::Get(), "f", sizeof(float), 3);
+		ue_py_add_struct_format(formats, TBaseStructure<FVector2D>::Get(), "f", sizeof(float), 2);
+		ue_py_add_struct_format(formats, TBaseStructure<FVector4>::Get(), "f", sizeof(float), 4);
+		// Pitch, Yaw, Roll
+		ue_py_add_struct_format(formats, TBaseStructure<FRotator>::Get(), "f", sizeof(float), 3);
+		ue_py_add_struct_format(formats, TBaseStructure<FQuat>::Get(), "f", sizeof(float), 4);
+		ue_py_add_struct_format(formats, TBaseStructure<FLinearColor>::Get(), "f", sizeof(float), 4);
+		// memory order is B, G, R, A
+		ue_py_add_struct_format(formats, TBaseStructure<FColor>::Get(), "B", sizeof(uint8), 4);
+		ue_py_add_struct_format(formats, TBaseStructure<FIntPoint>::Get(), "i", sizeof(int32), 2);
+		ue_py_add_struct_format(formats, TBaseStructure<FIntVector>::Get(), "i", sizeof(int32), 3);
+	}
+	return formats;
+}
+
+static bool ue_py_set_scalar_format(FPyArrayItemFormat &item_format, const char *format, Py_ssize_t item_size)
+{
+	item_format.Format = format;
+	item_format.ItemSize = item_size;
+	item_format.Components = 0;
+	return true;
+}
+
+bool py_ue_get_array_item_format(UProperty *prop, FPyArrayItemFormat &item_format)
+{
+	if (prop->IsA<UBoolProperty>())
+		return false;
+	if (prop->IsA<UFloatProperty>())
+		return ue_py_set_scalar_format(item_format, "f", sizeof(float));
+	if (prop->IsA<UDoubleProperty>())
+		return ue_py_set_scalar_format(item_format, "d", sizeof(double));
+	if (prop->IsA<UIntProperty>())
+		return ue_py_set_scalar_format(item_format, "i", sizeof(int32));
+	if (prop->IsA<UUInt32Property>())
+		return ue_py_set_scalar_format(item_format, "I", sizeof(uint32));
+	if (prop->IsA<UInt64Property>())
+		return ue_py_set_scalar_format(item_format, "q", sizeof(int64));
+	if (prop->IsA<UUInt64Property>())
+		return ue_py_set_scalar_format(item_format, "Q", sizeof(uint64));
+	if (prop->IsA<UInt16Property>())
+		return ue_py_set_scalar_format(item_format, "h", sizeof(int16));
+	if (prop->IsA<UUInt16Property>())
+		return ue_py_set_scalar_format(item_format, "H", sizeof(uint16));
+	if (prop->IsA<UInt8Property>())
+		return ue_py_set_scalar_format(item_format, "b", sizeof(int8));
+	if (prop->IsA<UByteProperty>())
+		return ue_py_set_scalar_format(item_format, "B", sizeof(uint8));
+#if ENGINE_MINOR_VERSION >= 15
+	if (auto casted_prop = Cast<UEnumProperty>(prop))
+		return py_ue_get_array_item_format(casted_prop->GetUnderlyingProperty(), item_format);
+#endif
+
+	if (auto casted_prop = Cast<UStructProperty>(prop))
+	{
+		for (const FPyArrayStructFormat &StructFormat : ue_py_get_struct_formats())
+		{
+			if (StructFormat.Struct == casted_prop->Struct)
+			{
+				// no padding allowed, items must be contiguous
+				if (prop->ElementSize != StructFormat.Format.ItemSize * StructFormat.Format.Components)
+					return false;
+				item_format = StructFormat.Format;
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+static UObject *ue_py_farray_property_view_get_owner(ue_PyFArrayPropertyView *self)
+{
+	if (!self->prop_ptr.IsValid())
+		return nullptr;
+	return self->owner.Get();
+}
+
+static PyObject *py_ue_farray_property_view_is_valid(ue_PyFArrayPropertyView *self, PyObject * args)
+{
+	if (ue_py_farray_property_view_get_owner(self))
+	{
+		Py_RETURN_TRUE;
+	}
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_farray_property_view_get_owner(ue_PyFArrayPropertyView *self, PyObject * args)
+{
+	UObject *owner = ue_py_farray_property_view_get_owner(self);
+	if (!owner)
+		return PyErr_Format(PyExc_Exception, "the owner of the array is no more valid");
+	Py_RETURN_UOBJECT(owner);
+}
+
+static PyMethodDef ue_PyFArrayPropertyView_methods[] = {
+	{ "is_valid", (PyCFunction)py_ue_farray_property_view_is_valid, METH_VARARGS, "" },
+	{ "get_owner", (PyCFunction)py_ue_farray_property_view_get_owner, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFArrayPropertyView_str(ue_PyFArrayPropertyView *self)
+{
+	UObject *owner = ue_py_farray_property_view_get_owner(self);
+	if (!owner)
+		return PyUnicode_FromString("<unreal_engine.FArrayPropertyView (invalid)>");
+	return PyUnicode_FromFormat("<unreal_engine.FArrayPropertyView {'property': '%s', 'owner': '%s', 'format': '%s', 'components': %d}>",
+		TCHAR_TO_UTF8(*self->prop->GetName()), TCHAR_TO_UTF8(*owner->GetName()), self->format.Format, self->format.Components);
+}
+
+static void ue_py_farray_property_view_dealloc(ue_PyFArrayPropertyView *self)
+{
+	self->owner.~FWeakObjectPtr();
+	self->prop_ptr.~FWeakObjectPtr();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static Py_ssize_t ue_py_farray_property_view_seq_length(ue_PyFArrayPropertyView *self)
+{
+	UObject *owner = ue_py_farray_property_view_get_owner(self);
+	if (!owner)
+	{
+		PyErr_SetString(PyExc_Exception, "the owner of the array is no more valid");
+		return -1;
+	}
+	FScriptArrayHelper_InContainer helper(self->prop, owner, self->index);
+	return helper.Num();
+}
+
+// returned for empty arrays (python does not like NULL buffers)
+static uint8 ue_py_farray_property_view_empty;
+
+// number of exported buffers for each TArray (more views can export the same array)
+static TMap<const void *, int32> ue_py_farray_exports;
+
+bool py_ue_farray_is_exported(const void *array)
+{
+	return ue_py_farray_exports.Contains(array);
+}
+
+static int ue_py_farray_property_view_getbuffer(ue_PyFArrayPropertyView *self, Py_buffer *view, int flags)
+{
+	UObject *owner = ue_py_farray_property_view_get_owner(self);
+	if (!owner)
+	{
+		view->obj = nullptr;
+		PyErr_SetString(PyExc_BufferError, "the owner of the array is no more valid");
+		return -1;
+	}
+
+	FScriptArrayHelper_InContainer helper(self->prop, owner, self->index);
+	Py_ssize_t element_size = self->prop->Inner->ElementSize;
+
+	// shape and strides must live until the buffer is released
+	Py_ssize_t *shape_and_strides = (Py_ssize_t *)PyMem_Malloc(sizeof(Py_ssize_t) * 4);
+	if (!shape_and_strides)
+	{
+		view->obj = nullptr;
+		PyErr_NoMemory();
+		return -1;
+	}
+
+	view->buf = helper.Num() > 0 ? helper.GetRawPtr() : &ue_py_farray_property_view_empty;
+	view->len = helper.Num() * element_size;
+	view->readonly = 0;
+	view->suboffsets = nullptr;
+	view->internal = shape_and_strides;
+
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->ndim = self->format.Components > 0 ? 2 : 1;
+		view->itemsize = self->format.ItemSize;
+		view->format = (flags & PyBUF_FORMAT) ? (char *)self->format.Format : nullptr;
+		shape_and_strides[0] = helper.Num();
+		shape_and_strides[1] = self->format.Components;
+		shape_and_strides[2] = element_size;
+		shape_and_strides[3] = self->format.ItemSize;
+		view->shape = shape_and_strides;
+		view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? shape_and_strides + 2 : nullptr;
+	}
+	else
+	{
+		// plain bytes
+		view->ndim = 1;
+		view->itemsize = 1;
+		view->format = (flags & PyBUF_FORMAT) ? (char *)"B" : nullptr;
+		view->shape = nullptr;
+		view->strides = nullptr;
+	}
+
+	// the owner cannot be garbage collected while python is accessing its memory
+	if (self->exports == 0)
+	{
+		if (!owner->IsRooted())
+		{
+			owner->AddToRoot();
+			self->rooted = true;
+		}
+		self->array = self->prop->ContainerPtrToValuePtr<void>(owner, self->index);
+	}
+	self->exports++;
+	ue_py_farray_exports.FindOrAdd(self->array)++;
+
+	view->obj = (PyObject *)self;
+	Py_INCREF(self);
+	return 0;
+}
+
+static void ue_py_farray_property_view_releasebuffer(ue_PyFArrayPropertyView *self, Py_buffer *view)
+{
+	PyMem_Free(view->internal);
+	view->internal = nullptr;
+
+	int32 *array_exports = ue_py_farray_exports.Find(self->array);
+	if (array_exports && --(*array_exports) <= 0)
+	{
+		ue_py_farray_exports.Remove(self->array);
+	}
+
+	self->exports--;
+	if (self->exports == 0)
+	{
+		if (self->rooted)
+		{
+			UObject *owner = self->owner.Get();
+			if (owner)
+			{
+				owner->RemoveFromRoot();
+			}
+			self->rooted = false;
+		}
+		self->array = nullptr;
+	}
+}
+
+static PyBufferProcs ue_PyFArrayPropertyView_buffer_procs;
+static PySequenceMethods ue_PyFArrayPropertyView_sequence_methods;
+
+static PyTypeObject ue_PyFArrayPropertyViewType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FArrayPropertyView", /* tp_name */
+	sizeof(ue_PyFArrayPropertyView), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_farray_property_view_dealloc, /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFArrayPropertyView_str, /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+#if PY_MAJOR_VERSION < 3
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_NEWBUFFER, /* tp_flags */
+#else
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+#endif
+	"Unreal Engine TArray property view (supports the buffer protocol)", /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFArrayPropertyView_methods, /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+};
+
+void ue_python_init_farray_property_view(PyObject *ue_module)
+{
+	memset(&ue_PyFArrayPropertyView_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFArrayPropertyViewType.tp_as_buffer = &ue_PyFArrayPropertyView_buffer_procs;
+	ue_PyFArrayPropertyView_buffer_procs.bf_getbuffer = (getbufferproc)ue_py_farray_property_view_getbuffer;
+	ue_PyFArrayPropertyView_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_py_farray_property_view_releasebuffer;
+
+	memset(&ue_PyFArrayPropertyView_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFArrayPropertyViewType.tp_as_sequence = &ue_PyFArrayPropertyView_sequence_methods;
+	ue_PyFArrayPropertyView_sequence_methods.sq_length = (lenfunc)ue_py_farray_property_view_seq_length;
+
+	if (PyType_Ready(&ue_PyFArrayPropertyViewType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFArrayPropertyViewType);
+	PyModule_AddObject(ue_module, "FArrayPropertyView", (PyObject *)&ue_PyFArrayPropertyViewType);
+}
+
+PyObject *py_ue_new_farray_property_view(UObject *owner, UArrayProperty *prop, int32 index)
+{
+	FPyArrayItemFormat format;
+	if (!py_ue_get_array_item_format(prop->Inner, format))
+		return PyErr_Format(PyExc_TypeError, "TArray property %s does not contain plain numeric items", TCHAR_TO_UTF8(*prop->GetName()));
+
+	ue_PyFArrayPropertyView *ret = (ue_PyFArrayPropertyView *)PyObject_New(ue_PyFArrayPropertyView, &ue_PyFArrayPropertyViewType);
+	new(&ret->owner) FWeakObjectPtr(owner);
+	ret->prop = prop;
+	new(&ret->prop_ptr) FWeakObjectPtr(prop);
+	ret->index = index;
+	ret->format = format;
+	ret->exports = 0;
+	ret->rooted = false;
+	ret->array = nullptr;
+	return (PyObject *)ret;
+}
+
+ue_PyFArrayPropertyView *py_ue_is_farray_property_view(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFArrayPropertyViewType))
+		return nullptr;
+	return (ue_PyFArrayPropertyView *)obj;
+}
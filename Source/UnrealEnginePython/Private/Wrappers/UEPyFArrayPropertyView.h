@@ -0,0 +1,44 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+/*
+ * memory layout of a TArray item that can be exposed with the python buffer protocol
+ * (a scalar, or a struct made of Components scalars of the same type)
+ */
+struct FPyArrayItemFormat
+{
+	// struct module format of a single scalar
+	const char *Format;
+	Py_ssize_t ItemSize;
+	// 0 for scalars
+	int32 Components;
+};
+
+bool py_ue_get_array_item_format(UProperty *, FPyArrayItemFormat &);
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		FWeakObjectPtr owner;
+	UArrayProperty *prop;
+	// the property could be regenerated (blueprint compilation)
+	FWeakObjectPtr prop_ptr;
+	int32 index;
+	FPyArrayItemFormat format;
+	// number of exported buffers
+	int32 exports;
+	// true if the owner has been added to the root set while buffers are exported
+	bool rooted;
+	// the TArray whose memory is exported (valid while exports > 0)
+	void *array;
+} ue_PyFArrayPropertyView;
+
+PyObject *py_ue_new_farray_property_view(UObject *, UArrayProperty *, int32);
+ue_PyFArrayPropertyView *py_ue_is_farray_property_view(PyObject *);
+
+// true if the memory of the TArray is exported by a view, so it cannot be reallocated
+bool py_ue_farray_is_exported(const void *);
+
+void ue_python_init_farray_property_view(PyObject *);
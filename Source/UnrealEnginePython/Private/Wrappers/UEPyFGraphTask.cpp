@@ -0,0 +1,446 @@
+#include "UEPyFGraphTask.h"
+
+FPyGraphTaskState::FPyGraphTaskState()
+{
+	py_callable = nullptr;
+	bDone = false;
+	py_result = nullptr;
+	py_exc_type = nullptr;
+	py_exc_value = nullptr;
+	py_exc_traceback = nullptr;
+	bExceptionRetrieved = false;
+	Handles = 0;
+}
+
+FPyGraphTaskState::~FPyGraphTaskState()
+{
+	// the last reference could be released by a TaskGraph thread
+	FScopePythonGIL gil;
+	Py_XDECREF(py_callable);
+	Py_XDECREF(py_result);
+	Py_XDECREF(py_exc_type);
+	Py_XDECREF(py_exc_value);
+	Py_XDECREF(py_exc_traceback);
+	for (PyObject *py_callback : py_callbacks)
+	{
+		Py_DECREF(py_callback);
+	}
+}
+
+void FPyGraphTaskState::Run()
+{
+	FScopePythonGIL gil;
+
+	// failures are propagated along the chain
+	for (FPyGraphTaskStatePtr &Input : Inputs)
+	{
+		if (Input->py_exc_type)
+		{
+			Input->bExceptionRetrieved = true;
+			py_exc_type = Input->py_exc_type;
+			py_exc_value = Input->py_exc_value;
+			py_exc_traceback = Input->py_exc_traceback;
+			Py_INCREF(py_exc_type);
+			Py_XINCREF(py_exc_value);
+			Py_XINCREF(py_exc_traceback);
+			Complete(nullptr, false);
+			return;
+		}
+	}
+
+	PyObject *py_inputs = PyTuple_New(Inputs.Num());
+	for (int32 i = 0; i < Inputs.Num(); i++)
+	{
+		Py_INCREF(Inputs[i]->py_result);
+		PyTuple_SetItem(py_inputs, i, Inputs[i]->py_result);
+	}
+
+	PyObject *ret = nullptr;
+	if (py_callable)
+	{
+		ret = PyObject_CallObject(py_callable, py_inputs);
+	}
+	else
+	{
+		ret = PySequence_List(py_inputs);
+	}
+	Py_DECREF(py_inputs);
+
+	Complete(ret);
+}
+
+void FPyGraphTaskState::Complete(PyObject *ret, bool bFetchError)
+{
+	if (ret)
+	{
+		py_result = ret;
+	}
+	else if (bFetchError)
+	{
+		PyErr_Fetch(&py_exc_type, &py_exc_value, &py_exc_traceback);
+		PyErr_NormalizeException(&py_exc_type, &py_exc_value, &py_exc_traceback);
+	}
+
+	Py_CLEAR(py_callable);
+	Inputs.Empty();
+	bDone = true;
+
+	if (py_callbacks.Num() > 0)
+	{
+		ScheduleCallbacks();
+	}
+	else if (Handles == 0)
+	{
+		LogUnretrievedException();
+	}
+}
+
+void FPyGraphTaskState::ScheduleCallbacks()
+{
+	if (IsInGameThread())
+	{
+		RunCallbacks();
+		return;
+	}
+
+	FPyGraphTaskStatePtr State = AsShared();
+	FFunctionGraphTask::CreateAndDispatchWhenReady([State]() {
+		FScopePythonGIL gil;
+		State->RunCallbacks();
+	}, TStatId(), nullptr, ENamedThreads::GameThread);
+}
+
+void FPyGraphTaskState::RunCallbacks()
+{
+	TArray<PyObject *> callbacks = MoveTemp(py_callbacks);
+	py_callbacks.Empty();
+
+	PyObject *py_handle = py_ue_new_fgraph_task(AsShared());
+	for (PyObject *py_callback : callbacks)
+	{
+		PyObject *ret = PyObject_CallFunctionObjArgs(py_callback, py_handle, nullptr);
+		if (!ret)
+		{
+			unreal_engine_py_log_error();
+		}
+		Py_XDECREF(ret);
+		Py_DECREF(py_callback);
+	}
+	Py_DECREF(py_handle);
+}
+
+void FPyGraphTaskState::LogUnretrievedException()
+{
+	if (!py_exc_type || bExceptionRetrieved)
+		return;
+	bExceptionRetrieved = true;
+	Py_INCREF(py_exc_type);
+	Py_XINCREF(py_exc_value);
+	Py_XINCREF(py_exc_traceback);
+	PyErr_Restore(py_exc_type, py_exc_value, py_exc_traceback);
+	unreal_engine_py_log_error();
+}
+
+static PyObject *py_ue_fgraph_task_done(ue_PyFGraphTask *self, PyObject * args)
+{
+	if (self->state->bDone)
+	{
+		Py_RETURN_TRUE;
+	}
+	Py_RETURN_FALSE;
+}
+
+static PyObject *py_ue_fgraph_task_result(ue_PyFGraphTask *self, PyObject * args)
+{
+	FPyGraphTaskStatePtr State = self->state;
+	if (!State->bDone)
+		return PyErr_Format(PyExc_Exception, "task is not completed");
+
+	if (State->py_exc_type)
+	{
+		State->bExceptionRetrieved = true;
+		Py_INCREF(State->py_exc_type);
+		Py_XINCREF(State->py_exc_value);
+		Py_XINCREF(State->py_exc_traceback);
+		PyErr_Restore(State->py_exc_type, State->py_exc_value, State->py_exc_traceback);
+		return nullptr;
+	}
+
+	Py_INCREF(State->py_result);
+	return State->py_result;
+}
+
+static PyObject *py_ue_fgraph_task_wait(ue_PyFGraphTask *self, PyObject * args)
+{
+	FGraphEventRef Event = self->state->Event;
+	if (Event.GetReference() && !self->state->bDone)
+	{
+		Py_BEGIN_ALLOW_THREADS;
+		FTaskGraphInterface::Get().WaitUntilTaskCompletes(Event);
+		Py_END_ALLOW_THREADS;
+	}
+	return py_ue_fgraph_task_result(self, nullptr);
+}
+
+static PyObject *py_ue_fgraph_task_add_done_callback(ue_PyFGraphTask *self, PyObject * args)
+{
+	PyObject *py_callable;
+	if (!PyArg_ParseTuple(args, "O:add_done_callback", &py_callable))
+	{
+		return nullptr;
+	}
+
+	if (!PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_TypeError, "argument is not callable");
+
+	Py_INCREF(py_callable);
+	self->state->py_callbacks.Add(py_callable);
+
+	if (self->state->bDone)
+		self->state->ScheduleCallbacks();
+
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fgraph_task_then(ue_PyFGraphTask *self, PyObject * args)
+{
+	PyObject *py_callable;
+	int named_thread = (int)ENamedThreads::GameThread;
+	if (!PyArg_ParseTuple(args, "O|i:then", &py_callable, &named_thread))
+	{
+		return nullptr;
+	}
+
+	if (!PyCallable_Check(py_callable))
+		return PyErr_Format(PyExc_TypeError, "argument is not callable");
+
+	TArray<FPyGraphTaskStatePtr> Inputs;
+	Inputs.Add(self->state);
+	FGraphEventArray Prerequisites;
+	Prerequisites.Add(self->state->Event);
+
+	return py_ue_dispatch_fgraph_task(py_callable, Inputs, Prerequisites, (ENamedThreads::Type)named_thread);
+}
+
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 5
+// called by the loop thread
+static PyObject *py_ue_fgraph_task_set_future(PyObject *self, PyObject * args)
+{
+	PyObject *py_future;
+	PyObject *py_task;
+	if (!PyArg_ParseTuple(args, "OO", &py_future, &py_task))
+	{
+		return nullptr;
+	}
+
+	PyObject *py_cancelled = PyObject_CallMethod(py_future, (char *)"cancelled", nullptr);
+	if (!py_cancelled)
+		return nullptr;
+	bool bCancelled = PyObject_IsTrue(py_cancelled) != 0;
+	Py_DECREF(py_cancelled);
+	if (bCancelled)
+		Py_RETURN_NONE;
+
+	FPyGraphTaskStatePtr State = ((ue_PyFGraphTask *)py_task)->state;
+	PyObject *ret = nullptr;
+	if (State->py_exc_type)
+	{
+		State->bExceptionRetrieved = true;
+		ret = PyObject_CallMethod(py_future, (char *)"set_exception", (char *)"O", State->py_exc_value ? State->py_exc_value : State->py_exc_type);
+	}
+	else
+	{
+		ret = PyObject_CallMethod(py_future, (char *)"set_result", (char *)"O", State->py_result);
+	}
+	if (!ret)
+		return nullptr;
+	Py_DECREF(ret);
+	Py_RETURN_NONE;
+}
+
+static PyMethodDef ue_py_fgraph_task_set_future_def = { "set_future", (PyCFunction)py_ue_fgraph_task_set_future, METH_VARARGS, "" };
+
+// done callback, self is a (loop, future) tuple
+static PyObject *py_ue_fgraph_task_wake_future(PyObject *self, PyObject * py_task)
+{
+	PyObject *py_loop = PyTuple_GetItem(self, 0);
+	PyObject *py_future = PyTuple_GetItem(self, 1);
+	PyObject *py_set_future = PyCFunction_New(&ue_py_fgraph_task_set_future_def, nullptr);
+	PyObject *ret = PyObject_CallMethod(py_loop, (char *)"call_soon_threadsafe", (char *)"OOO", py_set_future, py_future, py_task);
+	Py_DECREF(py_set_future);
+	return ret;
+}
+
+static PyMethodDef ue_py_fgraph_task_wake_future_def = { "wake_future", (PyCFunction)py_ue_fgraph_task_wake_future, METH_O, "" };
+
+static PyObject *py_ue_fgraph_task_await(ue_PyFGraphTask *self)
+{
+	PyObject *py_asyncio = PyImport_ImportModule("asyncio");
+	if (!py_asyncio)
+		return nullptr;
+
+	PyObject *py_loop = PyObject_CallMethod(py_asyncio, (char *)"get_event_loop", nullptr);
+	Py_DECREF(py_asyncio);
+	if (!py_loop)
+		return nullptr;
+
+	PyObject *py_future = PyObject_CallMethod(py_loop, (char *)"create_future", nullptr);
+	if (!py_future)
+	{
+		Py_DECREF(py_loop);
+		return nullptr;
+	}
+
+	PyObject *py_loop_future = PyTuple_Pack(2, py_loop, py_future);
+	PyObject *py_wake_future = PyCFunction_New(&ue_py_fgraph_task_wake_future_def, py_loop_future);
+	Py_DECREF(py_loop_future);
+	Py_DECREF(py_loop);
+
+	// the callback is scheduled immediately if the task is already done
+	self->state->py_callbacks.Add(py_wake_future);
+	if (self->state->bDone)
+		self->state->ScheduleCallbacks();
+
+	PyObject *py_await = PyObject_CallMethod(py_future, (char *)"__await__", nullptr);
+	Py_DECREF(py_future);
+	return py_await;
+}
+
+static PyAsyncMethods ue_PyFGraphTask_async = {
+	(unaryfunc)py_ue_fgraph_task_await, /* am_await */
+	0, /* am_aiter */
+	0, /* am_anext */
+};
+#endif
+
+static void ue_pyfgraph_task_dealloc(ue_PyFGraphTask *self)
+{
+	FPyGraphTaskState *State = self->state.Get();
+	State->Handles--;
+	if (State->Handles == 0 && State->bDone)
+		State->LogUnretrievedException();
+	self->state.~FPyGraphTaskStatePtr();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_pyfgraph_task_repr(ue_PyFGraphTask *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FGraphTask %s>", self->state->bDone ? (self->state->py_exc_type ? "failed" : "done") : "pending");
+}
+
+static PyMethodDef ue_PyFGraphTask_methods[] = {
+	{ "done", (PyCFunction)py_ue_fgraph_task_done, METH_VARARGS, "" },
+	{ "result", (PyCFunction)py_ue_fgraph_task_result, METH_VARARGS, "" },
+	{ "wait", (PyCFunction)py_ue_fgraph_task_wait, METH_VARARGS, "" },
+	{ "add_done_callback", (PyCFunction)py_ue_fgraph_task_add_done_callback, METH_VARARGS, "" },
+	{ "then", (PyCFunction)py_ue_fgraph_task_then, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyTypeObject ue_PyFGraphTaskType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FGraphTask", /* tp_name */
+	sizeof(ue_PyFGraphTask), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_pyfgraph_task_dealloc,       /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	(reprfunc)ue_pyfgraph_task_repr,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine TaskGraph task handle",           /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFGraphTask_methods,             /* tp_methods */
+	0,
+	0,
+};
+
+void ue_python_init_fgraph_task(PyObject *ue_module)
+{
+	// handles are only created by the dispatch functions
+#if PY_MAJOR_VERSION >= 3 && PY_MINOR_VERSION >= 5
+	ue_PyFGraphTaskType.tp_as_async = &ue_PyFGraphTask_async;
+#endif
+
+	if (PyType_Ready(&ue_PyFGraphTaskType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFGraphTaskType);
+	PyModule_AddObject(ue_module, "FGraphTask", (PyObject *)&ue_PyFGraphTaskType);
+}
+
+PyObject *py_ue_new_fgraph_task(FPyGraphTaskStatePtr State)
+{
+	ue_PyFGraphTask *ret = (ue_PyFGraphTask *)PyObject_New(ue_PyFGraphTask, &ue_PyFGraphTaskType);
+	new(&ret->state) FPyGraphTaskStatePtr(State);
+	State->Handles++;
+	return (PyObject *)ret;
+}
+
+PyObject *py_ue_dispatch_fgraph_task(PyObject *py_callable, TArray<FPyGraphTaskStatePtr> &Inputs, const FGraphEventArray &Prerequisites, ENamedThreads::Type NamedThread)
+{
+	FPyGraphTaskStatePtr State = MakeShareable(new FPyGraphTaskState());
+	State->py_callable = py_callable;
+	Py_XINCREF(State->py_callable);
+	State->Inputs = Inputs;
+
+	// the handle is created before dispatching, so the task cannot log an exception that will be retrieved
+	PyObject *py_handle = py_ue_new_fgraph_task(State);
+
+	// the task needs the GIL (held by the caller) to run python code, so the event is assigned before it can access the state
+	State->Event = FFunctionGraphTask::CreateAndDispatchWhenReady([State]() {
+		State->Run();
+	}, TStatId(), Prerequisites.Num() > 0 ? &Prerequisites : nullptr, NamedThread);
+
+	return py_handle;
+}
+
+ue_PyFGraphTask *py_ue_is_fgraph_task(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFGraphTaskType))
+		return nullptr;
+	return (ue_PyFGraphTask *)obj;
+}
+
+bool py_ue_fgraph_task_sequence(PyObject *py_tasks, FGraphEventArray &Events, TArray<FPyGraphTaskStatePtr> *States)
+{
+	PyObject *py_iter = PyObject_GetIter(py_tasks);
+	if (!py_iter)
+	{
+		PyErr_Format(PyExc_TypeError, "argument is not an iterable of FGraphTask");
+		return false;
+	}
+
+	while (PyObject *py_item = PyIter_Next(py_iter))
+	{
+		ue_PyFGraphTask *py_task = py_ue_is_fgraph_task(py_item);
+		Py_DECREF(py_item);
+		if (!py_task)
+		{
+			Py_DECREF(py_iter);
+			PyErr_Format(PyExc_TypeError, "argument is not an iterable of FGraphTask");
+			return false;
+		}
+		Events.Add(py_task->state->Event);
+		if (States)
+			States->Add(py_task->state);
+	}
+	Py_DECREF(py_iter);
+
+	return !PyErr_Occurred();
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "UEPyModule.h"
+#include "Async/TaskGraphInterfaces.h"
+
+// shared by the python handles and the TaskGraph task, python fields are only accessed with the GIL held
+struct FPyGraphTaskState : public TSharedFromThis<FPyGraphTaskState, ESPMode::ThreadSafe>
+{
+	FGraphEventRef Event;
+	PyObject *py_callable;
+	// then(): the results of the inputs are the arguments of the callable
+	// when_all(): no callable, the result is the list of the inputs results
+	TArray<TSharedPtr<FPyGraphTaskState, ESPMode::ThreadSafe>> Inputs;
+
+	bool bDone;
+	PyObject *py_result;
+	PyObject *py_exc_type;
+	PyObject *py_exc_value;
+	PyObject *py_exc_traceback;
+	bool bExceptionRetrieved;
+
+	// called (on the game thread) with the task handle when the task is done
+	TArray<PyObject *> py_callbacks;
+	int32 Handles;
+
+	FPyGraphTaskState();
+	~FPyGraphTaskState();
+
+	void Run();
+	// steals the result, or fetches the current python error if it is null (and no failed input was propagated)
+	void Complete(PyObject *, bool bFetchError = true);
+	void RunCallbacks();
+	void ScheduleCallbacks();
+	// logs the exception if nobody can retrieve it anymore
+	void LogUnretrievedException();
+};
+
+typedef TSharedPtr<FPyGraphTaskState, ESPMode::ThreadSafe> FPyGraphTaskStatePtr;
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		FPyGraphTaskStatePtr state;
+} ue_PyFGraphTask;
+
+// dispatches a task running the callable (can be null for fan-in) after the prerequisites
+PyObject *py_ue_dispatch_fgraph_task(PyObject *, TArray<FPyGraphTaskStatePtr> &, const FGraphEventArray &, ENamedThreads::Type);
+PyObject *py_ue_new_fgraph_task(FPyGraphTaskStatePtr);
+ue_PyFGraphTask *py_ue_is_fgraph_task(PyObject *);
+// fills the events (and optionally the states) of a sequence of task handles
+bool py_ue_fgraph_task_sequence(PyObject *, FGraphEventArray &, TArray<FPyGraphTaskStatePtr> *);
+
+void ue_python_init_fgraph_task(PyObject *);
@@ -1,5 +1,7 @@
 #include "UEPyFHitResult.h"
 
+#include "UEPyWrapperFreeList.h"
+
 #include "GameFramework/Actor.h"
 
 static PyObject *py_ue_fhitresult_get_reversed_hit(ue_PyFHitResult *self, PyObject * args)
@@ -112,9 +114,23 @@ static PyTypeObject ue_PyFHitResultType = {
 	ue_PyFHitResult_getseters,
 };
 
+static FPyWrapperFreeList ue_PyFHitResultFreeList(&ue_PyFHitResultType);
+
+static PyObject *ue_py_fhitresult_alloc(PyTypeObject *type, Py_ssize_t nitems)
+{
+	return ue_PyFHitResultFreeList.AllocZeroed(type);
+}
+
+static void ue_py_fhitresult_dealloc(ue_PyFHitResult *self)
+{
+	ue_PyFHitResultFreeList.Free((PyObject *)self);
+}
+
 void ue_python_init_fhitresult(PyObject *ue_module)
 {
 	ue_PyFHitResultType.tp_new = PyType_GenericNew;
+	ue_PyFHitResultType.tp_alloc = ue_py_fhitresult_alloc;
+	ue_PyFHitResultType.tp_dealloc = (destructor)ue_py_fhitresult_dealloc;
 
 	if (PyType_Ready(&ue_PyFHitResultType) < 0)
 		return;
@@ -125,7 +141,7 @@ void ue_python_init_fhitresult(PyObject *ue_module)
 
 PyObject *py_ue_new_fhitresult(FHitResult hit)
 {
-	ue_PyFHitResult *ret = (ue_PyFHitResult *)PyObject_New(ue_PyFHitResult, &ue_PyFHitResultType);
+	ue_PyFHitResult *ret = (ue_PyFHitResult *)ue_PyFHitResultFreeList.Alloc();
 	ret->hit = hit;
 	return (PyObject *)ret;
 }
@@ -0,0 +1,318 @@
+#include "UEPyFObjectIterator.h"
+
+#include "Engine/World.h"
+#include "Engine/Level.h"
+#include "GameFramework/Actor.h"
+#include "Components/ActorComponent.h"
+#include "UObject/UObjectHash.h"
+
+static bool ue_py_fobject_iterator_accept(ue_PyFObjectIterator *self, UObject *u_object, UClass *u_class, UClass *u_parent_class, UWorld *u_world)
+{
+	FPyObjectIteratorFilter &filter = self->filter;
+
+	if (u_object->IsPendingKillOrUnreachable())
+		return false;
+
+	if (filter.ExcludeFlags != RF_NoFlags && u_object->HasAnyFlags(filter.ExcludeFlags))
+		return false;
+
+	if (filter.Flags != RF_NoFlags && !u_object->HasAllFlags(filter.Flags))
+		return false;
+
+	if (u_class && !u_object->IsA(u_class))
+		return false;
+
+	if (u_parent_class)
+	{
+		UClass *u_object_class = Cast<UClass>(u_object);
+		if (!u_object_class || !u_object_class->IsChildOf(u_parent_class))
+			return false;
+	}
+
+	if (filter.Tag != NAME_None)
+	{
+		if (AActor *actor = Cast<AActor>(u_object))
+		{
+			if (!actor->ActorHasTag(filter.Tag))
+				return false;
+		}
+		else if (UActorComponent *component = Cast<UActorComponent>(u_object))
+		{
+			if (!component->ComponentHasTag(filter.Tag))
+				return false;
+		}
+		else
+		{
+			return false;
+		}
+	}
+
+	if (filter.ComponentClass.IsValid() || filter.bFilterBox || filter.bFilterSphere)
+	{
+		AActor *actor = Cast<AActor>(u_object);
+		if (!actor)
+			return false;
+
+		UClass *u_component_class = (UClass *)filter.ComponentClass.Get();
+		if (u_component_class && !actor->FindComponentByClass(u_component_class))
+			return false;
+
+		if (filter.bFilterBox || filter.bFilterSphere)
+		{
+			if (!actor->GetRootComponent())
+				return false;
+			FVector location = actor->GetActorLocation();
+			if (filter.bFilterBox && !filter.Box.IsInsideOrOn(location))
+				return false;
+			if (filter.bFilterSphere && FVector::DistSquared(location, filter.SphereCenter) > filter.SphereRadiusSquared)
+				return false;
+		}
+	}
+
+	// the most expensive check (it is virtual and generally walks the outer chain)
+	if (filter.bFilterWorld && u_object->GetWorld() != u_world)
+		return false;
+
+	// property predicates are checked last, as they need a python conversion
+	for (TPair<FName, PyObject *> &property : filter.Properties)
+	{
+		UProperty *u_property = u_object->GetClass()->FindPropertyByName(property.Key);
+		if (!u_property)
+			return false;
+		PyObject *py_value = ue_py_convert_property(u_property, (uint8 *)u_object, 0);
+		if (!py_value)
+		{
+			PyErr_Clear();
+			return false;
+		}
+		int equal = PyObject_RichCompareBool(py_value, property.Value, Py_EQ);
+		Py_DECREF(py_value);
+		if (equal < 0)
+			PyErr_Clear();
+		if (equal <= 0)
+			return false;
+	}
+
+	return true;
+}
+
+static UObject *ue_py_fobject_iterator_object_at(int32 index)
+{
+	FUObjectItem *item = GUObjectArray.IndexToObject(index);
+	if (!item || !item->Object || item->IsUnreachable() || item->IsPendingKill())
+		return nullptr;
+	return (UObject *)item->Object;
+}
+
+static UObject *ue_py_fobject_iterator_next_object(ue_PyFObjectIterator *self, UClass *u_class, UClass *u_parent_class, UWorld *u_world)
+{
+	if (self->mode == EPyObjectIteratorMode::Objects)
+	{
+		while (self->cursor < GUObjectArray.GetObjectArrayNum())
+		{
+			UObject *u_object = ue_py_fobject_iterator_object_at(self->cursor++);
+			if (u_object && ue_py_fobject_iterator_accept(self, u_object, u_class, u_parent_class, u_world))
+				return u_object;
+		}
+		return nullptr;
+	}
+
+	if (self->mode == EPyObjectIteratorMode::Indices)
+	{
+		// the objects could have been destroyed (and their slot reused) since the snapshot, so filters are checked again
+		while (self->cursor < self->indices.Num())
+		{
+			UObject *u_object = ue_py_fobject_iterator_object_at(self->indices[self->cursor++]);
+			if (u_object && ue_py_fobject_iterator_accept(self, u_object, u_class, u_parent_class, u_world))
+				return u_object;
+		}
+		return nullptr;
+	}
+
+	// levels and actors are read live, so streaming or spawning while iterating is safe
+	const TArray<ULevel *> &levels = u_world->GetLevels();
+	while (self->level_cursor < levels.Num())
+	{
+		ULevel *level = levels[self->level_cursor];
+		// same behaviour of TActorIterator (only active levels)
+		if (!level || (level != u_world->PersistentLevel && !level->bIsVisible))
+		{
+			self->level_cursor++;
+			self->cursor = 0;
+			continue;
+		}
+
+		while (self->cursor < level->Actors.Num())
+		{
+			AActor *actor = level->Actors[self->cursor++];
+			if (actor && ue_py_fobject_iterator_accept(self, actor, u_class, u_parent_class, u_world))
+				return actor;
+		}
+
+		self->level_cursor++;
+		self->cursor = 0;
+	}
+	return nullptr;
+}
+
+static PyObject *ue_py_fobject_iterator_iternext(ue_PyFObjectIterator *self)
+{
+	// resolve the weak references once per step (they could have been garbage collected between steps)
+	UClass *u_class = (UClass *)self->filter.Class.Get();
+	if (!u_class && self->filter.Class.IsStale())
+		return nullptr;
+
+	UClass *u_parent_class = (UClass *)self->filter.ParentClass.Get();
+	if (!u_parent_class && self->filter.ParentClass.IsStale())
+		return nullptr;
+
+	if (self->filter.ComponentClass.IsStale())
+		return nullptr;
+
+	UWorld *u_world = (UWorld *)self->filter.World.Get();
+	if ((self->filter.bFilterWorld || self->mode == EPyObjectIteratorMode::Actors) && !u_world)
+		return nullptr;
+
+	while (UObject *u_object = ue_py_fobject_iterator_next_object(self, u_class, u_parent_class, u_world))
+	{
+		ue_PyUObject *ret = ue_get_python_uobject_inc(u_object);
+		if (ret)
+			return (PyObject *)ret;
+	}
+
+	// StopIteration
+	return nullptr;
+}
+
+static PyObject *ue_PyFObjectIterator_str(ue_PyFObjectIterator *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FObjectIterator {'cursor': %d}>", self->cursor);
+}
+
+static void ue_py_fobject_iterator_dealloc(ue_PyFObjectIterator *self)
+{
+	for (TPair<FName, PyObject *> &property : self->filter.Properties)
+	{
+		Py_DECREF(property.Value);
+	}
+	self->filter.~FPyObjectIteratorFilter();
+	self->indices.~TArray<int32>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject ue_PyFObjectIteratorType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FObjectIterator", /* tp_name */
+	sizeof(ue_PyFObjectIterator), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_fobject_iterator_dealloc, /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFObjectIterator_str, /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine lazy UObject iterator", /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	PyObject_SelfIter,         /* tp_iter */
+	(iternextfunc)ue_py_fobject_iterator_iternext, /* tp_iternext */
+	0,                         /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+};
+
+void ue_python_init_fobject_iterator(PyObject *ue_module)
+{
+	if (PyType_Ready(&ue_PyFObjectIteratorType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFObjectIteratorType);
+	PyModule_AddObject(ue_module, "FObjectIterator", (PyObject *)&ue_PyFObjectIteratorType);
+}
+
+PyObject *py_ue_new_fobject_iterator(const FPyObjectIteratorFilter &filter, bool actors)
+{
+	ue_PyFObjectIterator *ret = (ue_PyFObjectIterator *)PyObject_New(ue_PyFObjectIterator, &ue_PyFObjectIteratorType);
+	new(&ret->filter) FPyObjectIteratorFilter(filter);
+	for (TPair<FName, PyObject *> &property : ret->filter.Properties)
+	{
+		Py_INCREF(property.Value);
+	}
+	new(&ret->indices) TArray<int32>();
+	ret->cursor = 0;
+	ret->level_cursor = 0;
+
+	UClass *u_class = (UClass *)filter.Class.Get();
+	if (actors)
+	{
+		ret->mode = EPyObjectIteratorMode::Actors;
+	}
+	else if (u_class && u_class != UObject::StaticClass())
+	{
+		// use the class hash instead of walking the whole object array
+		ret->mode = EPyObjectIteratorMode::Indices;
+		TArray<UObject *> objects;
+		GetObjectsOfClass(u_class, objects, true, filter.ExcludeFlags);
+		ret->indices.Reserve(objects.Num());
+		for (UObject *u_object : objects)
+		{
+			ret->indices.Add(GUObjectArray.ObjectToIndex(u_object));
+		}
+	}
+	else
+	{
+		ret->mode = EPyObjectIteratorMode::Objects;
+	}
+
+	return (PyObject *)ret;
+}
+
+ue_PyFObjectIterator *py_ue_is_fobject_iterator(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFObjectIteratorType))
+		return nullptr;
+	return (ue_PyFObjectIterator *)obj;
+}
+
+bool py_ue_fobject_iterator_filter_args(PyObject *args, PyObject *kwargs, const char *format, FPyObjectIteratorFilter &filter)
+{
+	PyObject *py_class = nullptr;
+	char *tag = nullptr;
+	unsigned long long flags = (unsigned long long)filter.Flags;
+	unsigned long long exclude_flags = (unsigned long long)filter.ExcludeFlags;
+
+	static char *kw_names[] = { (char *)"uclass", (char *)"tag", (char *)"flags", (char *)"exclude_flags", NULL };
+
+	if (!PyArg_ParseTupleAndKeywords(args, kwargs, format, kw_names, &py_class, &tag, &flags, &exclude_flags))
+		return false;
+
+	if (py_class && py_class != Py_None)
+	{
+		UClass *u_class = ue_py_check_type<UClass>(py_class);
+		if (!u_class)
+		{
+			PyErr_SetString(PyExc_TypeError, "argument is not a UClass");
+			return false;
+		}
+		filter.Class = u_class;
+	}
+
+	if (tag)
+		filter.Tag = FName(UTF8_TO_TCHAR(tag));
+
+	filter.Flags = (EObjectFlags)flags;
+	filter.ExcludeFlags = (EObjectFlags)exclude_flags;
+	return true;
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+/*
+ * lazy iteration of UObjects: filters are applied to the native objects and a python wrapper
+ * is created only for the yielded ones
+ */
+struct FPyObjectIteratorFilter
+{
+	// IsA() filter
+	FWeakObjectPtr Class;
+	// IsChildOf() filter (for iterating classes)
+	FWeakObjectPtr ParentClass;
+	// GetWorld() filter
+	FWeakObjectPtr World;
+	bool bFilterWorld;
+	// actor or component tag
+	FName Tag;
+	// all of them must be set
+	EObjectFlags Flags;
+	// none of them must be set
+	EObjectFlags ExcludeFlags;
+
+	// actor filters
+	FWeakObjectPtr ComponentClass;
+	bool bFilterBox;
+	FBox Box;
+	bool bFilterSphere;
+	FVector SphereCenter;
+	float SphereRadiusSquared;
+
+	// property name and python value (compared with ==), values are owned by the iterator
+	TArray<TPair<FName, PyObject *>> Properties;
+
+	FPyObjectIteratorFilter() : bFilterWorld(false), Tag(NAME_None), Flags(RF_NoFlags), ExcludeFlags(RF_ClassDefaultObject),
+		bFilterBox(false), Box(ForceInit), bFilterSphere(false), SphereCenter(FVector::ZeroVector), SphereRadiusSquared(0)
+	{
+	}
+};
+
+enum class EPyObjectIteratorMode : uint8
+{
+	// walk the whole GUObjectArray
+	Objects,
+	// walk the object indices collected by GetObjectsOfClass()
+	Indices,
+	// walk the actors of the visible levels of a world
+	Actors,
+};
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		EPyObjectIteratorMode mode;
+	FPyObjectIteratorFilter filter;
+	int32 cursor;
+	// Indices mode
+	TArray<int32> indices;
+	// Actors mode
+	int32 level_cursor;
+} ue_PyFObjectIterator;
+
+// the filter Properties values are borrowed, the iterator gets its own references
+PyObject *py_ue_new_fobject_iterator(const FPyObjectIteratorFilter &, bool);
+ue_PyFObjectIterator *py_ue_is_fobject_iterator(PyObject *);
+
+// parses the optional (uclass, tag, flags, exclude_flags) arguments
+bool py_ue_fobject_iterator_filter_args(PyObject *, PyObject *, const char *, FPyObjectIteratorFilter &);
+
+void ue_python_init_fobject_iterator(PyObject *);
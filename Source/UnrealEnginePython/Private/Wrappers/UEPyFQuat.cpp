@@ -1,5 +1,7 @@
 #include "UEPyFQuat.h"
 
+#include "UEPyWrapperFreeList.h"
+
 #if ENGINE_MINOR_VERSION > 12
 static PyObject *py_ue_fquat_angular_distance(ue_PyFQuat *self, PyObject * args)
 {
@@ -189,6 +191,18 @@ PyTypeObject ue_PyFQuatType = {
 	ue_PyFQuat_getseters,
 };
 
+static FPyWrapperFreeList ue_PyFQuatFreeList(&ue_PyFQuatType);
+
+static PyObject *ue_py_fquat_alloc(PyTypeObject *type, Py_ssize_t nitems)
+{
+	return ue_PyFQuatFreeList.AllocZeroed(type);
+}
+
+static void ue_py_fquat_dealloc(ue_PyFQuat *self)
+{
+	ue_PyFQuatFreeList.Free((PyObject *)self);
+}
+
 
 static PyObject *ue_py_fquat_add(ue_PyFQuat *self, PyObject *value)
 {
@@ -296,6 +310,8 @@ static int ue_py_fquat_init(ue_PyFQuat *self, PyObject *args, PyObject *kwargs)
 void ue_python_init_fquat(PyObject *ue_module)
 {
 	ue_PyFQuatType.tp_new = PyType_GenericNew;
+	ue_PyFQuatType.tp_alloc = ue_py_fquat_alloc;
+	ue_PyFQuatType.tp_dealloc = (destructor)ue_py_fquat_dealloc;
 
 	ue_PyFQuatType.tp_init = (initproc)ue_py_fquat_init;
 
@@ -320,7 +336,7 @@ void ue_python_init_fquat(PyObject *ue_module)
 
 PyObject *py_ue_new_fquat(FQuat quat)
 {
-	ue_PyFQuat *ret = (ue_PyFQuat *)PyObject_New(ue_PyFQuat, &ue_PyFQuatType);
+	ue_PyFQuat *ret = (ue_PyFQuat *)ue_PyFQuatFreeList.Alloc();
 	ret->quat = quat;
 	return (PyObject *)ret;
 }
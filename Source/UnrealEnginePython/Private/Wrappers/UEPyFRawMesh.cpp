@@ -221,7 +221,9 @@ static PyObject *py_ue_fraw_mesh_save_to_static_mesh_source_model(ue_PyFRawMesh
 	if (!self->raw_mesh.IsValidOrFixable())
 		return PyErr_Format(PyExc_Exception, "FRawMesh is not valid or fixable");
 
+	Py_BEGIN_ALLOW_THREADS;
 	source_model->RawMeshBulkData->SaveRawMesh(self->raw_mesh);
+	Py_END_ALLOW_THREADS;
 
 	Py_RETURN_NONE;
 }
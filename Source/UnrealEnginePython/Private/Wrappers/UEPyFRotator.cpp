@@ -1,5 +1,7 @@
 #include "UEPyFRotator.h"
 
+#include "UEPyWrapperFreeList.h"
+
 static PyObject *py_ue_frotator_get_vector(ue_PyFRotator *self, PyObject * args) {
 	FVector vec = self->rot.Vector();
 	return py_ue_new_fvector(vec);
@@ -130,6 +132,18 @@ PyTypeObject ue_PyFRotatorType = {
 	ue_PyFRotator_getseters,
 };
 
+static FPyWrapperFreeList ue_PyFRotatorFreeList(&ue_PyFRotatorType);
+
+static PyObject *ue_py_frotator_alloc(PyTypeObject *type, Py_ssize_t nitems)
+{
+	return ue_PyFRotatorFreeList.AllocZeroed(type);
+}
+
+static void ue_py_frotator_dealloc(ue_PyFRotator *self)
+{
+	ue_PyFRotatorFreeList.Free((PyObject *)self);
+}
+
 
 static PyObject *ue_py_frotator_add(ue_PyFRotator *self, PyObject *value) {
 	FRotator rot = self->rot;
@@ -249,6 +263,8 @@ static int ue_py_frotator_init(ue_PyFRotator *self, PyObject *args, PyObject *kw
 
 void ue_python_init_frotator(PyObject *ue_module) {
 	ue_PyFRotatorType.tp_new = PyType_GenericNew;
+	ue_PyFRotatorType.tp_alloc = ue_py_frotator_alloc;
+	ue_PyFRotatorType.tp_dealloc = (destructor)ue_py_frotator_dealloc;
 
 	ue_PyFRotatorType.tp_init = (initproc)ue_py_frotator_init;
 
@@ -272,7 +288,7 @@ void ue_python_init_frotator(PyObject *ue_module) {
 }
 
 PyObject *py_ue_new_frotator(FRotator rot) {
-	ue_PyFRotator *ret = (ue_PyFRotator *)PyObject_New(ue_PyFRotator, &ue_PyFRotatorType);
+	ue_PyFRotator *ret = (ue_PyFRotator *)ue_PyFRotatorFreeList.Alloc();
 	ret->rot = rot;
 	return (PyObject *)ret;
 }
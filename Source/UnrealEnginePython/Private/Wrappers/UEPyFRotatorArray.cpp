@@ -0,0 +1,429 @@
+#include "UEPyFRotatorArray.h"
+
+#include "UEPyFVectorArray.h"
+
+static bool ue_py_frotator_array_operand(ue_PyFRotatorArray *self, PyObject *py_obj, const float *&data, int32 &stride, FRotator &broadcast)
+{
+	if (ue_PyFRotatorArray *py_other = py_ue_is_frotator_array(py_obj))
+	{
+		if (py_other->rots.Num() != self->rots.Num())
+		{
+			PyErr_Format(PyExc_ValueError, "FRotatorArray length mismatch (%d and %d)", self->rots.Num(), py_other->rots.Num());
+			return false;
+		}
+		data = (const float *)py_other->rots.GetData();
+		stride = 3;
+		return true;
+	}
+
+	if (ue_PyFRotator *py_rot = py_ue_is_frotator(py_obj))
+	{
+		broadcast = py_rot->rot;
+		data = &broadcast.Pitch;
+		stride = 0;
+		return true;
+	}
+
+	FVector value;
+	if (!py_ue_is_fvector(py_obj) && py_ue_float3_operand(py_obj, value))
+	{
+		broadcast = FRotator(value.X, value.Y, value.Z);
+		data = &broadcast.Pitch;
+		stride = 0;
+		return true;
+	}
+
+	PyErr_Format(PyExc_TypeError, "argument is not a FRotatorArray, a FRotator or a number");
+	return false;
+}
+
+static PyObject *py_ue_frotator_array_normalize(ue_PyFRotatorArray *self, PyObject * args)
+{
+	for (FRotator &Rot : self->rots)
+	{
+		Rot.Normalize();
+	}
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_frotator_array_normalized(ue_PyFRotatorArray *self, PyObject * args)
+{
+	ue_PyFRotatorArray *py_ret = (ue_PyFRotatorArray *)py_ue_new_frotator_array(self->rots.Num());
+	for (int32 i = 0; i < self->rots.Num(); i++)
+	{
+		py_ret->rots[i] = self->rots[i].GetNormalized();
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_frotator_array_vector(ue_PyFRotatorArray *self, PyObject * args)
+{
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->rots.Num());
+	for (int32 i = 0; i < self->rots.Num(); i++)
+	{
+		py_ret->vecs[i] = self->rots[i].Vector();
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_frotator_array_rotate_vector(ue_PyFRotatorArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:rotate_vector", &py_obj))
+		return nullptr;
+
+	const FVector *vecs = nullptr;
+	int32 stride = 0;
+	FVector broadcast;
+	if (ue_PyFVectorArray *py_vecs = py_ue_is_fvector_array(py_obj))
+	{
+		if (py_vecs->vecs.Num() != self->rots.Num())
+			return PyErr_Format(PyExc_ValueError, "FVectorArray length mismatch (%d and %d)", self->rots.Num(), py_vecs->vecs.Num());
+		vecs = py_vecs->vecs.GetData();
+		stride = 1;
+	}
+	else if (ue_PyFVector *py_vec = py_ue_is_fvector(py_obj))
+	{
+		broadcast = py_vec->vec;
+		vecs = &broadcast;
+	}
+	else
+	{
+		return PyErr_Format(PyExc_TypeError, "argument is not a FVectorArray or a FVector");
+	}
+
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->rots.Num());
+	float *out = (float *)py_ret->vecs.GetData();
+	for (int32 i = 0; i < self->rots.Num(); i++)
+	{
+		FQuat Quat = self->rots[i].Quaternion();
+		VectorStoreFloat3(VectorQuaternionRotateVector(VectorLoadAligned(&Quat), VectorLoadFloat3_W0(&vecs[i * stride])), out + i * 3);
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_frotator_array_copy(ue_PyFRotatorArray *self, PyObject * args)
+{
+	ue_PyFRotatorArray *py_ret = (ue_PyFRotatorArray *)py_ue_new_frotator_array(0);
+	py_ret->rots = self->rots;
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_frotator_array_to_list(ue_PyFRotatorArray *self, PyObject * args)
+{
+	PyObject *py_list = PyList_New(self->rots.Num());
+	for (int32 i = 0; i < self->rots.Num(); i++)
+	{
+		PyList_SET_ITEM(py_list, i, py_ue_new_frotator(self->rots[i]));
+	}
+	return py_list;
+}
+
+static PyMethodDef ue_PyFRotatorArray_methods[] = {
+	{ "normalize", (PyCFunction)py_ue_frotator_array_normalize, METH_VARARGS, "" },
+	{ "normalized", (PyCFunction)py_ue_frotator_array_normalized, METH_VARARGS, "" },
+	{ "vector", (PyCFunction)py_ue_frotator_array_vector, METH_VARARGS, "" },
+	{ "rotate_vector", (PyCFunction)py_ue_frotator_array_rotate_vector, METH_VARARGS, "" },
+	{ "copy", (PyCFunction)py_ue_frotator_array_copy, METH_VARARGS, "" },
+	{ "to_list", (PyCFunction)py_ue_frotator_array_to_list, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFRotatorArray_str(ue_PyFRotatorArray *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FRotatorArray {'len': %d}>", self->rots.Num());
+}
+
+static void ue_py_frotator_array_dealloc(ue_PyFRotatorArray *self)
+{
+	self->rots.~TArray<FRotator>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_py_frotator_array_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+	ue_PyFRotatorArray *self = (ue_PyFRotatorArray *)type->tp_alloc(type, 0);
+	if (self)
+	{
+		new(&self->rots) TArray<FRotator>();
+		self->exports = 0;
+	}
+	return (PyObject *)self;
+}
+
+static int ue_py_frotator_array_init(ue_PyFRotatorArray *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_obj = nullptr;
+	if (!PyArg_ParseTuple(args, "|O", &py_obj))
+		return -1;
+
+	if (self->exports > 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "FRotatorArray is exporting buffers");
+		return -1;
+	}
+
+	if ((PyObject *)self == py_obj)
+		return 0;
+
+	self->rots.Empty();
+
+	if (!py_obj)
+		return 0;
+
+	// FRotatorArray(size)
+	if (PyNumber_Check(py_obj) && !PyObject_CheckBuffer(py_obj) && !PySequence_Check(py_obj))
+	{
+		PyObject *py_long = PyNumber_Long(py_obj);
+		if (!py_long)
+			return -1;
+		long num = PyLong_AsLong(py_long);
+		Py_DECREF(py_long);
+		if (num < 0)
+		{
+			PyErr_SetString(PyExc_ValueError, "FRotatorArray size cannot be negative");
+			return -1;
+		}
+		self->rots.AddZeroed(num);
+		return 0;
+	}
+
+	// float32 buffer with (len, 3) shape (pitch, yaw, roll)
+	Py_buffer view;
+	Py_ssize_t num = py_ue_float_records_from_buffer(py_obj, 3, &view);
+	if (num >= 0)
+	{
+		self->rots.SetNumUninitialized(num);
+		FMemory::Memcpy(self->rots.GetData(), view.buf, view.len);
+		PyBuffer_Release(&view);
+		return 0;
+	}
+
+	// sequence of FRotator
+	PyObject *py_fast = PySequence_Fast(py_obj, "argument is not a size, a float32 buffer or a sequence of FRotator");
+	if (!py_fast)
+		return -1;
+
+	Py_ssize_t py_len = PySequence_Fast_GET_SIZE(py_fast);
+	PyObject **py_items = PySequence_Fast_ITEMS(py_fast);
+	self->rots.SetNumUninitialized(py_len);
+	for (Py_ssize_t i = 0; i < py_len; i++)
+	{
+		ue_PyFRotator *py_rot = py_ue_is_frotator(py_items[i]);
+		if (!py_rot)
+		{
+			Py_DECREF(py_fast);
+			self->rots.Empty();
+			PyErr_Format(PyExc_TypeError, "item %d is not a FRotator", (int)i);
+			return -1;
+		}
+		self->rots[i] = py_rot->rot;
+	}
+	Py_DECREF(py_fast);
+	return 0;
+}
+
+static Py_ssize_t ue_py_frotator_array_seq_length(ue_PyFRotatorArray *self)
+{
+	return self->rots.Num();
+}
+
+static PyObject *ue_py_frotator_array_seq_item(ue_PyFRotatorArray *self, Py_ssize_t i)
+{
+	if (i < 0 || i >= self->rots.Num())
+		return PyErr_Format(PyExc_IndexError, "FRotatorArray index out of range");
+	return py_ue_new_frotator(self->rots[i]);
+}
+
+static int ue_py_frotator_array_seq_ass_item(ue_PyFRotatorArray *self, Py_ssize_t i, PyObject *value)
+{
+	if (i < 0 || i >= self->rots.Num())
+	{
+		PyErr_SetString(PyExc_IndexError, "FRotatorArray index out of range");
+		return -1;
+	}
+	ue_PyFRotator *py_rot = value ? py_ue_is_frotator(value) : nullptr;
+	if (!py_rot)
+	{
+		PyErr_SetString(PyExc_TypeError, "value is not a FRotator");
+		return -1;
+	}
+	self->rots[i] = py_rot->rot;
+	return 0;
+}
+
+static PyObject *ue_py_frotator_array_binary_op(PyObject *a, PyObject *b, char op, bool inplace)
+{
+	ue_PyFRotatorArray *self = py_ue_is_frotator_array(a);
+	if (!self)
+	{
+		if (op == '-')
+		{
+			Py_INCREF(Py_NotImplemented);
+			return Py_NotImplemented;
+		}
+		self = py_ue_is_frotator_array(b);
+		b = a;
+	}
+
+	const float *data;
+	int32 stride;
+	FRotator broadcast;
+	if (!ue_py_frotator_array_operand(self, b, data, stride, broadcast))
+	{
+		if (PyErr_ExceptionMatches(PyExc_TypeError))
+		{
+			PyErr_Clear();
+			Py_INCREF(Py_NotImplemented);
+			return Py_NotImplemented;
+		}
+		return nullptr;
+	}
+
+	ue_PyFRotatorArray *py_ret = self;
+	if (inplace)
+	{
+		Py_INCREF(py_ret);
+	}
+	else
+	{
+		py_ret = (ue_PyFRotatorArray *)py_ue_new_frotator_array(self->rots.Num());
+	}
+
+	// FRotator is made of 3 packed floats too
+	py_ue_float3_batch_op(op, (const float *)self->rots.GetData(), data, stride, (float *)py_ret->rots.GetData(), self->rots.Num());
+	return (PyObject *)py_ret;
+}
+
+static PyObject *ue_py_frotator_array_add(PyObject *a, PyObject *b)
+{
+	return ue_py_frotator_array_binary_op(a, b, '+', false);
+}
+
+static PyObject *ue_py_frotator_array_sub(PyObject *a, PyObject *b)
+{
+	return ue_py_frotator_array_binary_op(a, b, '-', false);
+}
+
+static PyObject *ue_py_frotator_array_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_frotator_array_binary_op(a, b, '*', false);
+}
+
+static PyObject *ue_py_frotator_array_inplace_add(PyObject *a, PyObject *b)
+{
+	return ue_py_frotator_array_binary_op(a, b, '+', true);
+}
+
+static PyObject *ue_py_frotator_array_inplace_sub(PyObject *a, PyObject *b)
+{
+	return ue_py_frotator_array_binary_op(a, b, '-', true);
+}
+
+static PyObject *ue_py_frotator_array_inplace_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_frotator_array_binary_op(a, b, '*', true);
+}
+
+static int ue_py_frotator_array_getbuffer(ue_PyFRotatorArray *self, Py_buffer *view, int flags)
+{
+	if (py_ue_float_records_getbuffer((PyObject *)self, (float *)self->rots.GetData(), self->rots.Num(), 3, view, flags) < 0)
+		return -1;
+	self->exports++;
+	return 0;
+}
+
+static void ue_py_frotator_array_releasebuffer(ue_PyFRotatorArray *self, Py_buffer *view)
+{
+	py_ue_float_records_releasebuffer((PyObject *)self, view);
+	self->exports--;
+}
+
+static PyNumberMethods ue_PyFRotatorArray_number_methods;
+static PySequenceMethods ue_PyFRotatorArray_sequence_methods;
+static PyBufferProcs ue_PyFRotatorArray_buffer_procs;
+
+static PyTypeObject ue_PyFRotatorArrayType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FRotatorArray", /* tp_name */
+	sizeof(ue_PyFRotatorArray), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_frotator_array_dealloc, /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFRotatorArray_str, /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+#if PY_MAJOR_VERSION < 3
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_CHECKTYPES | Py_TPFLAGS_HAVE_NEWBUFFER | Py_TPFLAGS_HAVE_INPLACEOPS, /* tp_flags */
+#else
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+#endif
+	"Unreal Engine FRotatorArray", /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFRotatorArray_methods, /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+};
+
+void ue_python_init_frotator_array(PyObject *ue_module)
+{
+	ue_PyFRotatorArrayType.tp_new = ue_py_frotator_array_new;
+	ue_PyFRotatorArrayType.tp_init = (initproc)ue_py_frotator_array_init;
+
+	memset(&ue_PyFRotatorArray_number_methods, 0, sizeof(PyNumberMethods));
+	ue_PyFRotatorArrayType.tp_as_number = &ue_PyFRotatorArray_number_methods;
+	ue_PyFRotatorArray_number_methods.nb_add = (binaryfunc)ue_py_frotator_array_add;
+	ue_PyFRotatorArray_number_methods.nb_subtract = (binaryfunc)ue_py_frotator_array_sub;
+	ue_PyFRotatorArray_number_methods.nb_multiply = (binaryfunc)ue_py_frotator_array_mul;
+	ue_PyFRotatorArray_number_methods.nb_inplace_add = (binaryfunc)ue_py_frotator_array_inplace_add;
+	ue_PyFRotatorArray_number_methods.nb_inplace_subtract = (binaryfunc)ue_py_frotator_array_inplace_sub;
+	ue_PyFRotatorArray_number_methods.nb_inplace_multiply = (binaryfunc)ue_py_frotator_array_inplace_mul;
+
+	memset(&ue_PyFRotatorArray_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFRotatorArrayType.tp_as_sequence = &ue_PyFRotatorArray_sequence_methods;
+	ue_PyFRotatorArray_sequence_methods.sq_length = (lenfunc)ue_py_frotator_array_seq_length;
+	ue_PyFRotatorArray_sequence_methods.sq_item = (ssizeargfunc)ue_py_frotator_array_seq_item;
+	ue_PyFRotatorArray_sequence_methods.sq_ass_item = (ssizeobjargproc)ue_py_frotator_array_seq_ass_item;
+
+	memset(&ue_PyFRotatorArray_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFRotatorArrayType.tp_as_buffer = &ue_PyFRotatorArray_buffer_procs;
+	ue_PyFRotatorArray_buffer_procs.bf_getbuffer = (getbufferproc)ue_py_frotator_array_getbuffer;
+	ue_PyFRotatorArray_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_py_frotator_array_releasebuffer;
+
+	if (PyType_Ready(&ue_PyFRotatorArrayType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFRotatorArrayType);
+	PyModule_AddObject(ue_module, "FRotatorArray", (PyObject *)&ue_PyFRotatorArrayType);
+}
+
+PyObject *py_ue_new_frotator_array(int32 num)
+{
+	ue_PyFRotatorArray *ret = (ue_PyFRotatorArray *)PyObject_New(ue_PyFRotatorArray, &ue_PyFRotatorArrayType);
+	new(&ret->rots) TArray<FRotator>();
+	ret->rots.AddZeroed(num);
+	ret->exports = 0;
+	return (PyObject *)ret;
+}
+
+ue_PyFRotatorArray *py_ue_is_frotator_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFRotatorArrayType))
+		return nullptr;
+	return (ue_PyFRotatorArray *)obj;
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<FRotator> rots;
+	// number of exported buffers (the array cannot be reallocated while > 0)
+	int32 exports;
+} ue_PyFRotatorArray;
+
+PyObject *py_ue_new_frotator_array(int32);
+ue_PyFRotatorArray *py_ue_is_frotator_array(PyObject *);
+
+void ue_python_init_frotator_array(PyObject *);
@@ -0,0 +1,396 @@
+#include "UEPyFTextureMipLock.h"
+
+static void ue_py_ftexture_mip_lock_unlock(FPyTextureMipLockEntry &entry, UTexture2D *tex)
+{
+	if (entry.bSource)
+	{
+#if WITH_EDITOR
+		tex->Source.UnlockMip(entry.Mip);
+#endif
+	}
+	else
+	{
+		tex->PlatformData->Mips[entry.Mip].BulkData.Unlock();
+	}
+}
+
+#if PY_MAJOR_VERSION >= 3
+// exports the locked memory of a mip, counting the buffers (the memoryview and its slices/casts) still using it
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		void *data;
+	Py_ssize_t size;
+	bool readonly;
+	int32 exports;
+} ue_PyFTextureMipBuffer;
+
+static int ue_py_ftexture_mip_buffer_getbuffer(ue_PyFTextureMipBuffer *self, Py_buffer *view, int flags)
+{
+	if (!self->data)
+	{
+		view->obj = nullptr;
+		PyErr_SetString(PyExc_BufferError, "the mip has already been unlocked");
+		return -1;
+	}
+
+	if (PyBuffer_FillInfo(view, (PyObject *)self, self->data, self->size, self->readonly ? 1 : 0, flags) < 0)
+		return -1;
+
+	self->exports++;
+	return 0;
+}
+
+static void ue_py_ftexture_mip_buffer_releasebuffer(ue_PyFTextureMipBuffer *self, Py_buffer *view)
+{
+	self->exports--;
+}
+
+static PyBufferProcs ue_PyFTextureMipBuffer_buffer_procs;
+
+static PyTypeObject ue_PyFTextureMipBufferType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FTextureMipBuffer", /* tp_name */
+	sizeof(ue_PyFTextureMipBuffer), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	0,                         /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	0,                         /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine locked texture mip memory", /* tp_doc */
+};
+#endif
+
+// returns false (with python error set) if the memory of some mip is still exported: those mips stay locked
+// (and can be committed again later), all the others are unlocked anyway
+static bool ue_py_ftexture_mip_lock_commit(ue_PyFTextureMipLock *self)
+{
+	TArray<FPyTextureMipLockEntry> exported;
+	TArray<UTexture2D *> modified;
+	TArray<UTexture2D *> rooted;
+	for (FPyTextureMipLockEntry &entry : self->entries)
+	{
+		if (entry.py_view)
+		{
+#if PY_MAJOR_VERSION >= 3
+			// fails if the view itself is exported (like numpy.frombuffer())
+			PyObject *ret = PyObject_CallMethod(entry.py_view, (char *)"release", nullptr);
+			if (!ret)
+			{
+				PyErr_Clear();
+				exported.Add(entry);
+				continue;
+			}
+			Py_DECREF(ret);
+#endif
+			Py_CLEAR(entry.py_view);
+		}
+
+#if PY_MAJOR_VERSION >= 3
+		// slices and casts of the view survive its release
+		ue_PyFTextureMipBuffer *py_exporter = (ue_PyFTextureMipBuffer *)entry.py_exporter;
+		if (py_exporter->exports > 0)
+		{
+			exported.Add(entry);
+			continue;
+		}
+		py_exporter->data = nullptr;
+		Py_CLEAR(entry.py_exporter);
+#endif
+
+		UTexture2D *tex = entry.Texture.Get();
+		if (!tex)
+			continue;
+		ue_py_ftexture_mip_lock_unlock(entry, tex);
+		if (entry.bDirty)
+			modified.AddUnique(tex);
+		if (entry.bRooted)
+			rooted.Add(tex);
+	}
+	self->entries = exported;
+
+	// textures with mips still locked are updated (and removed from the root set) when the last one is unlocked
+	for (FPyTextureMipLockEntry &entry : self->entries)
+	{
+		UTexture2D *tex = entry.Texture.Get();
+		if (modified.Remove(tex) > 0)
+			entry.bDirty = true;
+		if (rooted.Remove(tex) > 0)
+			entry.bRooted = true;
+	}
+
+	// once per texture, regardless of the number of modified mips
+	if (modified.Num() > 0)
+	{
+		Py_BEGIN_ALLOW_THREADS;
+		for (UTexture2D *tex : modified)
+		{
+			tex->MarkPackageDirty();
+#if WITH_EDITOR
+			tex->PostEditChange();
+#endif
+			tex->UpdateResource();
+		}
+		Py_END_ALLOW_THREADS;
+	}
+
+	for (UTexture2D *tex : rooted)
+	{
+		tex->RemoveFromRoot();
+	}
+
+	if (self->entries.Num() > 0)
+	{
+		PyErr_Format(PyExc_BufferError, "%d locked mips are still exported, release the objects using their memory and commit again", self->entries.Num());
+		return false;
+	}
+
+	return true;
+}
+
+PyObject *py_ue_ftexture_mip_lock_add(ue_PyFTextureMipLock *self, UTexture2D *tex, int32 mip, bool source, bool readonly)
+{
+	for (FPyTextureMipLockEntry &entry : self->entries)
+	{
+		if (entry.Texture.Get() == tex && entry.Mip == mip && entry.bSource == source)
+			return PyErr_Format(PyExc_Exception, "mip %d of %s is already locked", mip, TCHAR_TO_UTF8(*tex->GetName()));
+	}
+
+	void *data = nullptr;
+	Py_ssize_t size = 0;
+
+	if (source)
+	{
+#if WITH_EDITOR
+		if (mip < 0 || mip >= tex->Source.GetNumMips())
+			return PyErr_Format(PyExc_Exception, "invalid mipmap id");
+		data = tex->Source.LockMip(mip);
+		size = (Py_ssize_t)tex->Source.CalcMipSize(mip);
+#else
+		return PyErr_Format(PyExc_Exception, "source data is available only in the editor");
+#endif
+	}
+	else
+	{
+		if (!tex->PlatformData || mip < 0 || mip >= tex->PlatformData->Mips.Num())
+			return PyErr_Format(PyExc_Exception, "invalid mipmap id");
+		FByteBulkData &bulk_data = tex->PlatformData->Mips[mip].BulkData;
+		data = bulk_data.Lock(readonly ? LOCK_READ_ONLY : LOCK_READ_WRITE);
+		size = (Py_ssize_t)bulk_data.GetBulkDataSize();
+	}
+
+	FPyTextureMipLockEntry entry;
+	entry.Texture = tex;
+	entry.Mip = mip;
+	entry.bSource = source;
+	entry.bReadOnly = readonly;
+	entry.bRooted = false;
+	entry.bDirty = !readonly;
+	entry.py_view = nullptr;
+	entry.py_exporter = nullptr;
+
+	if (!data)
+	{
+		ue_py_ftexture_mip_lock_unlock(entry, tex);
+		return PyErr_Format(PyExc_Exception, "unable to lock mip %d of %s", mip, TCHAR_TO_UTF8(*tex->GetName()));
+	}
+
+#if PY_MAJOR_VERSION >= 3
+	ue_PyFTextureMipBuffer *py_exporter = PyObject_New(ue_PyFTextureMipBuffer, &ue_PyFTextureMipBufferType);
+	if (!py_exporter)
+	{
+		ue_py_ftexture_mip_lock_unlock(entry, tex);
+		return nullptr;
+	}
+	py_exporter->data = data;
+	py_exporter->size = size;
+	py_exporter->readonly = readonly;
+	py_exporter->exports = 0;
+	entry.py_exporter = (PyObject *)py_exporter;
+	entry.py_view = PyMemoryView_FromObject(entry.py_exporter);
+#else
+	entry.py_view = readonly ? PyBuffer_FromMemory(data, size) : PyBuffer_FromReadWriteMemory(data, size);
+#endif
+	if (!entry.py_view)
+	{
+		Py_XDECREF(entry.py_exporter);
+		ue_py_ftexture_mip_lock_unlock(entry, tex);
+		return nullptr;
+	}
+
+	// the texture cannot be garbage collected while its memory is locked
+	if (!tex->IsRooted())
+	{
+		tex->AddToRoot();
+		entry.bRooted = true;
+	}
+
+	self->entries.Add(entry);
+	return entry.py_view;
+}
+
+static PyObject *py_ue_ftexture_mip_lock_lock(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	PyObject *py_texture;
+	int mip = 0;
+	PyObject *py_source = nullptr;
+	PyObject *py_readonly = nullptr;
+	if (!PyArg_ParseTuple(args, "O|iOO:lock", &py_texture, &mip, &py_source, &py_readonly))
+	{
+		return nullptr;
+	}
+
+	UTexture2D *tex = ue_py_check_type<UTexture2D>(py_texture);
+	if (!tex)
+		return PyErr_Format(PyExc_Exception, "argument is not a Texture2D");
+
+	PyObject *py_view = py_ue_ftexture_mip_lock_add(self, tex, mip, py_source && PyObject_IsTrue(py_source), py_readonly && PyObject_IsTrue(py_readonly));
+	if (!py_view)
+		return nullptr;
+
+	Py_INCREF(py_view);
+	return py_view;
+}
+
+static PyObject *py_ue_ftexture_mip_lock_commit(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	if (!ue_py_ftexture_mip_lock_commit(self))
+		return nullptr;
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_ftexture_mip_lock_enter(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	if (self->single)
+	{
+		if (self->entries.Num() == 0 || !self->entries[0].py_view)
+			return PyErr_Format(PyExc_Exception, "the mip has already been committed");
+		Py_INCREF(self->entries[0].py_view);
+		return self->entries[0].py_view;
+	}
+
+	Py_INCREF(self);
+	return (PyObject *)self;
+}
+
+static PyObject *py_ue_ftexture_mip_lock_exit(ue_PyFTextureMipLock *self, PyObject * args)
+{
+	// mips are committed even if the block raised an exception (the exception is propagated)
+	if (!ue_py_ftexture_mip_lock_commit(self))
+		return nullptr;
+	Py_RETURN_FALSE;
+}
+
+static PyMethodDef ue_PyFTextureMipLock_methods[] = {
+	{ "lock", (PyCFunction)py_ue_ftexture_mip_lock_lock, METH_VARARGS, "" },
+	{ "commit", (PyCFunction)py_ue_ftexture_mip_lock_commit, METH_VARARGS, "" },
+	{ "__enter__", (PyCFunction)py_ue_ftexture_mip_lock_enter, METH_VARARGS, "" },
+	{ "__exit__", (PyCFunction)py_ue_ftexture_mip_lock_exit, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFTextureMipLock_str(ue_PyFTextureMipLock *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FTextureMipLock {'locked_mips': %d}>", self->entries.Num());
+}
+
+static void ue_py_ftexture_mip_lock_dealloc(ue_PyFTextureMipLock *self)
+{
+	if (self->entries.Num() > 0)
+	{
+		PyObject *type, *value, *traceback;
+		PyErr_Fetch(&type, &value, &traceback);
+		if (!ue_py_ftexture_mip_lock_commit(self))
+		{
+			// the memory is still referenced by python, so the exported mips are left locked
+			unreal_engine_py_log_error();
+			for (FPyTextureMipLockEntry &entry : self->entries)
+			{
+				Py_XDECREF(entry.py_view);
+				Py_XDECREF(entry.py_exporter);
+			}
+		}
+		PyErr_Restore(type, value, traceback);
+	}
+	self->entries.~TArray<FPyTextureMipLockEntry>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyTypeObject ue_PyFTextureMipLockType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FTextureMipLock", /* tp_name */
+	sizeof(ue_PyFTextureMipLock), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_ftexture_mip_lock_dealloc, /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFTextureMipLock_str, /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+	"Unreal Engine locked texture mips (context manager)", /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFTextureMipLock_methods, /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+};
+
+void ue_python_init_ftexture_mip_lock(PyObject *ue_module)
+{
+#if PY_MAJOR_VERSION >= 3
+	memset(&ue_PyFTextureMipBuffer_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFTextureMipBufferType.tp_as_buffer = &ue_PyFTextureMipBuffer_buffer_procs;
+	ue_PyFTextureMipBuffer_buffer_procs.bf_getbuffer = (getbufferproc)ue_py_ftexture_mip_buffer_getbuffer;
+	ue_PyFTextureMipBuffer_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_py_ftexture_mip_buffer_releasebuffer;
+	if (PyType_Ready(&ue_PyFTextureMipBufferType) < 0)
+		return;
+#endif
+
+	if (PyType_Ready(&ue_PyFTextureMipLockType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFTextureMipLockType);
+	PyModule_AddObject(ue_module, "FTextureMipLock", (PyObject *)&ue_PyFTextureMipLockType);
+}
+
+PyObject *py_ue_new_ftexture_mip_lock()
+{
+	ue_PyFTextureMipLock *ret = (ue_PyFTextureMipLock *)PyObject_New(ue_PyFTextureMipLock, &ue_PyFTextureMipLockType);
+	new(&ret->entries) TArray<FPyTextureMipLockEntry>();
+	ret->single = false;
+	return (PyObject *)ret;
+}
+
+ue_PyFTextureMipLock *py_ue_is_ftexture_mip_lock(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFTextureMipLockType))
+		return nullptr;
+	return (ue_PyFTextureMipLock *)obj;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+#include "Engine/Texture2D.h"
+
+// a mip locked until the owning FTextureMipLock is committed
+struct FPyTextureMipLockEntry
+{
+	TWeakObjectPtr<UTexture2D> Texture;
+	int32 Mip;
+	// the mip belongs to the source data (editor only)
+	bool bSource;
+	bool bReadOnly;
+	// true if the texture has been added to the root set while locked
+	bool bRooted;
+	// the texture has to be updated when this mip is unlocked
+	bool bDirty;
+	// memoryview of the locked memory, released before unlocking
+	PyObject *py_view;
+	// object exporting the locked memory to py_view and to the views derived from it (python 3 only)
+	PyObject *py_exporter;
+};
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<FPyTextureMipLockEntry> entries;
+	// created by texture_lock_mip(): __enter__ returns the memoryview of the only mip
+	bool single;
+} ue_PyFTextureMipLock;
+
+PyObject *py_ue_new_ftexture_mip_lock();
+ue_PyFTextureMipLock *py_ue_is_ftexture_mip_lock(PyObject *);
+// returns the memoryview (borrowed) of the locked mip or nullptr with python error set
+PyObject *py_ue_ftexture_mip_lock_add(ue_PyFTextureMipLock *, UTexture2D *, int32, bool, bool);
+
+void ue_python_init_ftexture_mip_lock(PyObject *);
@@ -1,5 +1,7 @@
 #include "UEPyFTransform.h"
 
+#include "UEPyWrapperFreeList.h"
+
 static PyObject *py_ue_ftransform_inverse(ue_PyFTransform *self, PyObject * args)
 {
 	return py_ue_new_ftransform(self->transform.Inverse());
@@ -253,6 +255,18 @@ PyTypeObject ue_PyFTransformType = {
 	ue_PyFTransform_getseters,
 };
 
+static FPyWrapperFreeList ue_PyFTransformFreeList(&ue_PyFTransformType);
+
+static PyObject *ue_py_ftransform_alloc(PyTypeObject *type, Py_ssize_t nitems)
+{
+	return ue_PyFTransformFreeList.AllocZeroed(type);
+}
+
+static void ue_py_ftransform_dealloc(ue_PyFTransform *self)
+{
+	ue_PyFTransformFreeList.Free((PyObject *)self);
+}
+
 static int ue_py_ftransform_init(ue_PyFTransform *self, PyObject *args, PyObject *kwargs)
 {
 	PyObject *py_translation = nullptr;
@@ -381,6 +395,8 @@ PyNumberMethods ue_PyFTransform_number_methods;
 void ue_python_init_ftransform(PyObject *ue_module)
 {
 	ue_PyFTransformType.tp_new = PyType_GenericNew;
+	ue_PyFTransformType.tp_alloc = ue_py_ftransform_alloc;
+	ue_PyFTransformType.tp_dealloc = (destructor)ue_py_ftransform_dealloc;
 
 	ue_PyFTransformType.tp_init = (initproc)ue_py_ftransform_init;
 
@@ -397,7 +413,7 @@ void ue_python_init_ftransform(PyObject *ue_module)
 
 PyObject *py_ue_new_ftransform(FTransform transform)
 {
-	ue_PyFTransform *ret = (ue_PyFTransform *)PyObject_New(ue_PyFTransform, &ue_PyFTransformType);
+	ue_PyFTransform *ret = (ue_PyFTransform *)ue_PyFTransformFreeList.Alloc();
 	ret->transform = transform;
 	return (PyObject *)ret;
 }
@@ -0,0 +1,432 @@
+#include "UEPyFTransformArray.h"
+
+#include "UEPyFVectorArray.h"
+#include "UEPyFRotatorArray.h"
+
+// FVectorArray (or a single FVector applied to every transform)
+static bool ue_py_ftransform_array_vectors_arg(ue_PyFTransformArray *self, PyObject *py_obj, const FVector *&vecs, int32 &stride, FVector &broadcast)
+{
+	if (ue_PyFVectorArray *py_vecs = py_ue_is_fvector_array(py_obj))
+	{
+		if (py_vecs->vecs.Num() != self->transforms.Num())
+		{
+			PyErr_Format(PyExc_ValueError, "FVectorArray length mismatch (%d and %d)", self->transforms.Num(), py_vecs->vecs.Num());
+			return false;
+		}
+		vecs = py_vecs->vecs.GetData();
+		stride = 1;
+		return true;
+	}
+
+	if (ue_PyFVector *py_vec = py_ue_is_fvector(py_obj))
+	{
+		broadcast = py_vec->vec;
+		vecs = &broadcast;
+		stride = 0;
+		return true;
+	}
+
+	PyErr_Format(PyExc_TypeError, "argument is not a FVectorArray or a FVector");
+	return false;
+}
+
+// same math of FTransform::TransformPosition() and FTransform::TransformVector()
+static PyObject *ue_py_ftransform_array_transform(ue_PyFTransformArray *self, PyObject *args, bool translate)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O", &py_obj))
+		return nullptr;
+
+	const FVector *vecs;
+	int32 stride;
+	FVector broadcast;
+	if (!ue_py_ftransform_array_vectors_arg(self, py_obj, vecs, stride, broadcast))
+		return nullptr;
+
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->transforms.Num());
+	float *out = (float *)py_ret->vecs.GetData();
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		const FPyTransformRecord &Record = self->transforms[i];
+		VectorRegister Rotation = VectorLoad(Record.Rotation);
+		VectorRegister Scale3D = VectorLoadFloat3_W0(Record.Scale3D);
+		VectorRegister Scaled = VectorMultiply(Scale3D, VectorLoadFloat3_W0(&vecs[i * stride]));
+		VectorRegister Result = VectorQuaternionRotateVector(Rotation, Scaled);
+		if (translate)
+		{
+			Result = VectorAdd(Result, VectorLoadFloat3_W0(Record.Translation));
+		}
+		VectorStoreFloat3(Result, out + i * 3);
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_ftransform_array_transform_position(ue_PyFTransformArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_transform(self, args, true);
+}
+
+static PyObject *py_ue_ftransform_array_transform_vector(ue_PyFTransformArray *self, PyObject * args)
+{
+	return ue_py_ftransform_array_transform(self, args, false);
+}
+
+static PyObject *py_ue_ftransform_array_inverse(ue_PyFTransformArray *self, PyObject * args)
+{
+	ue_PyFTransformArray *py_ret = (ue_PyFTransformArray *)py_ue_new_ftransform_array(self->transforms.Num());
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		ue_py_transform_to_transform_record(ue_py_transform_record_to_transform(self->transforms[i]).Inverse(), py_ret->transforms[i]);
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_ftransform_array_get_translations(ue_PyFTransformArray *self, PyObject * args)
+{
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->transforms.Num());
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		FMemory::Memcpy(&py_ret->vecs[i], self->transforms[i].Translation, sizeof(FVector));
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_ftransform_array_get_scales(ue_PyFTransformArray *self, PyObject * args)
+{
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->transforms.Num());
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		FMemory::Memcpy(&py_ret->vecs[i], self->transforms[i].Scale3D, sizeof(FVector));
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_ftransform_array_get_rotations(ue_PyFTransformArray *self, PyObject * args)
+{
+	ue_PyFRotatorArray *py_ret = (ue_PyFRotatorArray *)py_ue_new_frotator_array(self->transforms.Num());
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		const FPyTransformRecord &Record = self->transforms[i];
+		py_ret->rots[i] = FQuat(Record.Rotation[0], Record.Rotation[1], Record.Rotation[2], Record.Rotation[3]).Rotator();
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_ftransform_array_copy(ue_PyFTransformArray *self, PyObject * args)
+{
+	ue_PyFTransformArray *py_ret = (ue_PyFTransformArray *)py_ue_new_ftransform_array(0);
+	py_ret->transforms = self->transforms;
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_ftransform_array_to_list(ue_PyFTransformArray *self, PyObject * args)
+{
+	PyObject *py_list = PyList_New(self->transforms.Num());
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		PyList_SET_ITEM(py_list, i, py_ue_new_ftransform(ue_py_transform_record_to_transform(self->transforms[i])));
+	}
+	return py_list;
+}
+
+static PyMethodDef ue_PyFTransformArray_methods[] = {
+	{ "transform_position", (PyCFunction)py_ue_ftransform_array_transform_position, METH_VARARGS, "" },
+	{ "transform_vector", (PyCFunction)py_ue_ftransform_array_transform_vector, METH_VARARGS, "" },
+	{ "inverse", (PyCFunction)py_ue_ftransform_array_inverse, METH_VARARGS, "" },
+	{ "get_translations", (PyCFunction)py_ue_ftransform_array_get_translations, METH_VARARGS, "" },
+	{ "get_rotations", (PyCFunction)py_ue_ftransform_array_get_rotations, METH_VARARGS, "" },
+	{ "get_scales", (PyCFunction)py_ue_ftransform_array_get_scales, METH_VARARGS, "" },
+	{ "copy", (PyCFunction)py_ue_ftransform_array_copy, METH_VARARGS, "" },
+	{ "to_list", (PyCFunction)py_ue_ftransform_array_to_list, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFTransformArray_str(ue_PyFTransformArray *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FTransformArray {'len': %d}>", self->transforms.Num());
+}
+
+static void ue_py_ftransform_array_dealloc(ue_PyFTransformArray *self)
+{
+	self->transforms.~TArray<FPyTransformRecord>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_py_ftransform_array_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+	ue_PyFTransformArray *self = (ue_PyFTransformArray *)type->tp_alloc(type, 0);
+	if (self)
+	{
+		new(&self->transforms) TArray<FPyTransformRecord>();
+		self->exports = 0;
+	}
+	return (PyObject *)self;
+}
+
+static void ue_py_ftransform_array_set_identity(ue_PyFTransformArray *self, int32 num)
+{
+	FPyTransformRecord Identity;
+	ue_py_transform_to_transform_record(FTransform::Identity, Identity);
+	self->transforms.Init(Identity, num);
+}
+
+static int ue_py_ftransform_array_init(ue_PyFTransformArray *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_obj = nullptr;
+	if (!PyArg_ParseTuple(args, "|O", &py_obj))
+		return -1;
+
+	if (self->exports > 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "FTransformArray is exporting buffers");
+		return -1;
+	}
+
+	if ((PyObject *)self == py_obj)
+		return 0;
+
+	self->transforms.Empty();
+
+	if (!py_obj)
+		return 0;
+
+	// FTransformArray(size), filled with identity transforms
+	if (PyNumber_Check(py_obj) && !PyObject_CheckBuffer(py_obj) && !PySequence_Check(py_obj))
+	{
+		PyObject *py_long = PyNumber_Long(py_obj);
+		if (!py_long)
+			return -1;
+		long num = PyLong_AsLong(py_long);
+		Py_DECREF(py_long);
+		if (num < 0)
+		{
+			PyErr_SetString(PyExc_ValueError, "FTransformArray size cannot be negative");
+			return -1;
+		}
+		ue_py_ftransform_array_set_identity(self, num);
+		return 0;
+	}
+
+	// float32 buffer with (len, 10) shape
+	Py_buffer view;
+	Py_ssize_t num = py_ue_float_records_from_buffer(py_obj, 10, &view);
+	if (num >= 0)
+	{
+		self->transforms.SetNumUninitialized(num);
+		FMemory::Memcpy(self->transforms.GetData(), view.buf, view.len);
+		PyBuffer_Release(&view);
+		return 0;
+	}
+
+	// sequence of FTransform
+	PyObject *py_fast = PySequence_Fast(py_obj, "argument is not a size, a float32 buffer or a sequence of FTransform");
+	if (!py_fast)
+		return -1;
+
+	Py_ssize_t py_len = PySequence_Fast_GET_SIZE(py_fast);
+	PyObject **py_items = PySequence_Fast_ITEMS(py_fast);
+	self->transforms.SetNumUninitialized(py_len);
+	for (Py_ssize_t i = 0; i < py_len; i++)
+	{
+		ue_PyFTransform *py_transform = py_ue_is_ftransform(py_items[i]);
+		if (!py_transform)
+		{
+			Py_DECREF(py_fast);
+			self->transforms.Empty();
+			PyErr_Format(PyExc_TypeError, "item %d is not a FTransform", (int)i);
+			return -1;
+		}
+		ue_py_transform_to_transform_record(py_transform->transform, self->transforms[i]);
+	}
+	Py_DECREF(py_fast);
+	return 0;
+}
+
+static Py_ssize_t ue_py_ftransform_array_seq_length(ue_PyFTransformArray *self)
+{
+	return self->transforms.Num();
+}
+
+static PyObject *ue_py_ftransform_array_seq_item(ue_PyFTransformArray *self, Py_ssize_t i)
+{
+	if (i < 0 || i >= self->transforms.Num())
+		return PyErr_Format(PyExc_IndexError, "FTransformArray index out of range");
+	return py_ue_new_ftransform(ue_py_transform_record_to_transform(self->transforms[i]));
+}
+
+static int ue_py_ftransform_array_seq_ass_item(ue_PyFTransformArray *self, Py_ssize_t i, PyObject *value)
+{
+	if (i < 0 || i >= self->transforms.Num())
+	{
+		PyErr_SetString(PyExc_IndexError, "FTransformArray index out of range");
+		return -1;
+	}
+	ue_PyFTransform *py_transform = value ? py_ue_is_ftransform(value) : nullptr;
+	if (!py_transform)
+	{
+		PyErr_SetString(PyExc_TypeError, "value is not a FTransform");
+		return -1;
+	}
+	ue_py_transform_to_transform_record(py_transform->transform, self->transforms[i]);
+	return 0;
+}
+
+// composition, the result is the same of FTransform * FTransform for each item
+static PyObject *ue_py_ftransform_array_compose(PyObject *a, PyObject *b, bool inplace)
+{
+	ue_PyFTransformArray *self = py_ue_is_ftransform_array(a);
+	ue_PyFTransformArray *py_other = py_ue_is_ftransform_array(b);
+	ue_PyFTransform *py_transform = nullptr;
+	// true if the array is the right operand (FTransform * FTransformArray)
+	bool bRight = false;
+
+	if (self && py_other)
+	{
+		if (self->transforms.Num() != py_other->transforms.Num())
+			return PyErr_Format(PyExc_ValueError, "FTransformArray length mismatch (%d and %d)", self->transforms.Num(), py_other->transforms.Num());
+	}
+	else if (self)
+	{
+		py_transform = py_ue_is_ftransform(b);
+	}
+	else
+	{
+		self = py_other;
+		py_other = nullptr;
+		py_transform = py_ue_is_ftransform(a);
+		bRight = true;
+	}
+
+	if (!self || (!py_other && !py_transform))
+	{
+		Py_INCREF(Py_NotImplemented);
+		return Py_NotImplemented;
+	}
+
+	ue_PyFTransformArray *py_ret = self;
+	if (inplace && !bRight)
+	{
+		Py_INCREF(py_ret);
+	}
+	else
+	{
+		py_ret = (ue_PyFTransformArray *)py_ue_new_ftransform_array(self->transforms.Num());
+	}
+
+	for (int32 i = 0; i < self->transforms.Num(); i++)
+	{
+		FTransform Transform = ue_py_transform_record_to_transform(self->transforms[i]);
+		FTransform Other = py_other ? ue_py_transform_record_to_transform(py_other->transforms[i]) : py_transform->transform;
+		ue_py_transform_to_transform_record(bRight ? Other * Transform : Transform * Other, py_ret->transforms[i]);
+	}
+	return (PyObject *)py_ret;
+}
+
+static PyObject *ue_py_ftransform_array_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_ftransform_array_compose(a, b, false);
+}
+
+static PyObject *ue_py_ftransform_array_inplace_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_ftransform_array_compose(a, b, true);
+}
+
+static int ue_py_ftransform_array_getbuffer(ue_PyFTransformArray *self, Py_buffer *view, int flags)
+{
+	if (py_ue_float_records_getbuffer((PyObject *)self, (float *)self->transforms.GetData(), self->transforms.Num(), 10, view, flags) < 0)
+		return -1;
+	self->exports++;
+	return 0;
+}
+
+static void ue_py_ftransform_array_releasebuffer(ue_PyFTransformArray *self, Py_buffer *view)
+{
+	py_ue_float_records_releasebuffer((PyObject *)self, view);
+	self->exports--;
+}
+
+static PyNumberMethods ue_PyFTransformArray_number_methods;
+static PySequenceMethods ue_PyFTransformArray_sequence_methods;
+static PyBufferProcs ue_PyFTransformArray_buffer_procs;
+
+static PyTypeObject ue_PyFTransformArrayType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FTransformArray", /* tp_name */
+	sizeof(ue_PyFTransformArray), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_ftransform_array_dealloc, /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFTransformArray_str, /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+#if PY_MAJOR_VERSION < 3
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_CHECKTYPES | Py_TPFLAGS_HAVE_NEWBUFFER | Py_TPFLAGS_HAVE_INPLACEOPS, /* tp_flags */
+#else
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+#endif
+	"Unreal Engine FTransformArray", /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFTransformArray_methods, /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+};
+
+void ue_python_init_ftransform_array(PyObject *ue_module)
+{
+	ue_PyFTransformArrayType.tp_new = ue_py_ftransform_array_new;
+	ue_PyFTransformArrayType.tp_init = (initproc)ue_py_ftransform_array_init;
+
+	memset(&ue_PyFTransformArray_number_methods, 0, sizeof(PyNumberMethods));
+	ue_PyFTransformArrayType.tp_as_number = &ue_PyFTransformArray_number_methods;
+	ue_PyFTransformArray_number_methods.nb_multiply = (binaryfunc)ue_py_ftransform_array_mul;
+	ue_PyFTransformArray_number_methods.nb_inplace_multiply = (binaryfunc)ue_py_ftransform_array_inplace_mul;
+
+	memset(&ue_PyFTransformArray_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFTransformArrayType.tp_as_sequence = &ue_PyFTransformArray_sequence_methods;
+	ue_PyFTransformArray_sequence_methods.sq_length = (lenfunc)ue_py_ftransform_array_seq_length;
+	ue_PyFTransformArray_sequence_methods.sq_item = (ssizeargfunc)ue_py_ftransform_array_seq_item;
+	ue_PyFTransformArray_sequence_methods.sq_ass_item = (ssizeobjargproc)ue_py_ftransform_array_seq_ass_item;
+
+	memset(&ue_PyFTransformArray_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFTransformArrayType.tp_as_buffer = &ue_PyFTransformArray_buffer_procs;
+	ue_PyFTransformArray_buffer_procs.bf_getbuffer = (getbufferproc)ue_py_ftransform_array_getbuffer;
+	ue_PyFTransformArray_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_py_ftransform_array_releasebuffer;
+
+	if (PyType_Ready(&ue_PyFTransformArrayType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFTransformArrayType);
+	PyModule_AddObject(ue_module, "FTransformArray", (PyObject *)&ue_PyFTransformArrayType);
+}
+
+PyObject *py_ue_new_ftransform_array(int32 num)
+{
+	ue_PyFTransformArray *ret = (ue_PyFTransformArray *)PyObject_New(ue_PyFTransformArray, &ue_PyFTransformArrayType);
+	new(&ret->transforms) TArray<FPyTransformRecord>();
+	ue_py_ftransform_array_set_identity(ret, num);
+	ret->exports = 0;
+	return (PyObject *)ret;
+}
+
+ue_PyFTransformArray *py_ue_is_ftransform_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFTransformArrayType))
+		return nullptr;
+	return (ue_PyFTransformArray *)obj;
+}
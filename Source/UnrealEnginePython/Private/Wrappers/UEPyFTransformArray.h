@@ -0,0 +1,49 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+// packed (no SIMD padding) transform, exposed as 10 floats (rotation quaternion xyzw, translation xyz, scale xyz)
+struct FPyTransformRecord
+{
+	float Rotation[4];
+	float Translation[3];
+	float Scale3D[3];
+};
+
+static FORCEINLINE FTransform ue_py_transform_record_to_transform(const FPyTransformRecord &Record)
+{
+	return FTransform(FQuat(Record.Rotation[0], Record.Rotation[1], Record.Rotation[2], Record.Rotation[3]),
+		FVector(Record.Translation[0], Record.Translation[1], Record.Translation[2]),
+		FVector(Record.Scale3D[0], Record.Scale3D[1], Record.Scale3D[2]));
+}
+
+static FORCEINLINE void ue_py_transform_to_transform_record(const FTransform &Transform, FPyTransformRecord &Record)
+{
+	FQuat Rotation = Transform.GetRotation();
+	FVector Translation = Transform.GetTranslation();
+	FVector Scale3D = Transform.GetScale3D();
+	Record.Rotation[0] = Rotation.X;
+	Record.Rotation[1] = Rotation.Y;
+	Record.Rotation[2] = Rotation.Z;
+	Record.Rotation[3] = Rotation.W;
+	Record.Translation[0] = Translation.X;
+	Record.Translation[1] = Translation.Y;
+	Record.Translation[2] = Translation.Z;
+	Record.Scale3D[0] = Scale3D.X;
+	Record.Scale3D[1] = Scale3D.Y;
+	Record.Scale3D[2] = Scale3D.Z;
+}
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<FPyTransformRecord> transforms;
+	// number of exported buffers (the array cannot be reallocated while > 0)
+	int32 exports;
+} ue_PyFTransformArray;
+
+PyObject *py_ue_new_ftransform_array(int32);
+ue_PyFTransformArray *py_ue_is_ftransform_array(PyObject *);
+
+void ue_python_init_ftransform_array(PyObject *);
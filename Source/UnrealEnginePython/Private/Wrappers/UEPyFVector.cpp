@@ -1,5 +1,7 @@
 #include "UEPyFVector.h"
 
+#include "UEPyWrapperFreeList.h"
+
 static PyObject *py_ue_fvector_length(ue_PyFVector *self, PyObject * args)
 {
 	return PyFloat_FromDouble(self->vec.Size());
@@ -188,6 +190,18 @@ PyTypeObject ue_PyFVectorType = {
 	ue_PyFVector_getseters,
 };
 
+static FPyWrapperFreeList ue_PyFVectorFreeList(&ue_PyFVectorType);
+
+static PyObject *ue_py_fvector_alloc(PyTypeObject *type, Py_ssize_t nitems)
+{
+	return ue_PyFVectorFreeList.AllocZeroed(type);
+}
+
+static void ue_py_fvector_dealloc(ue_PyFVector *self)
+{
+	ue_PyFVectorFreeList.Free((PyObject *)self);
+}
+
 
 static PyObject *ue_py_fvector_add(ue_PyFVector *self, PyObject *value)
 {
@@ -372,6 +386,8 @@ static PyObject *ue_py_fvector_richcompare(ue_PyFVector *vec1, PyObject *b, int
 void ue_python_init_fvector(PyObject *ue_module)
 {
 	ue_PyFVectorType.tp_new = PyType_GenericNew;
+	ue_PyFVectorType.tp_alloc = ue_py_fvector_alloc;
+	ue_PyFVectorType.tp_dealloc = (destructor)ue_py_fvector_dealloc;
 
 	ue_PyFVectorType.tp_init = (initproc)ue_py_fvector_init;
 	ue_PyFVectorType.tp_richcompare = (richcmpfunc)ue_py_fvector_richcompare;
@@ -402,7 +418,7 @@ void ue_python_init_fvector(PyObject *ue_module)
 
 PyObject *py_ue_new_fvector(FVector vec)
 {
-	ue_PyFVector *ret = (ue_PyFVector *)PyObject_New(ue_PyFVector, &ue_PyFVectorType);
+	ue_PyFVector *ret = (ue_PyFVector *)ue_PyFVectorFreeList.Alloc();
 	ret->vec = vec;
 	return (PyObject *)ret;
 }
@@ -0,0 +1,620 @@
+#include "UEPyFVectorArray.h"
+
+// shared helpers
+
+int py_ue_float_records_getbuffer(PyObject *owner, float *data, int32 num, int32 components, Py_buffer *view, int flags)
+{
+	// shape and strides must live until the buffer is released
+	Py_ssize_t *shape_and_strides = (Py_ssize_t *)PyMem_Malloc(sizeof(Py_ssize_t) * 4);
+	if (!shape_and_strides)
+	{
+		view->obj = nullptr;
+		PyErr_NoMemory();
+		return -1;
+	}
+
+	static float empty;
+
+	view->buf = num > 0 ? data : &empty;
+	view->len = num * components * sizeof(float);
+	view->readonly = 0;
+	view->suboffsets = nullptr;
+	view->internal = shape_and_strides;
+
+	if ((flags & PyBUF_ND) == PyBUF_ND)
+	{
+		view->ndim = 2;
+		view->itemsize = sizeof(float);
+		view->format = (flags & PyBUF_FORMAT) ? (char *)"f" : nullptr;
+		shape_and_strides[0] = num;
+		shape_and_strides[1] = components;
+		shape_and_strides[2] = components * sizeof(float);
+		shape_and_strides[3] = sizeof(float);
+		view->shape = shape_and_strides;
+		view->strides = (flags & PyBUF_STRIDES) == PyBUF_STRIDES ? shape_and_strides + 2 : nullptr;
+	}
+	else
+	{
+		view->ndim = 1;
+		view->itemsize = 1;
+		view->format = (flags & PyBUF_FORMAT) ? (char *)"B" : nullptr;
+		view->shape = nullptr;
+		view->strides = nullptr;
+	}
+
+	view->obj = owner;
+	Py_INCREF(owner);
+	return 0;
+}
+
+void py_ue_float_records_releasebuffer(PyObject *owner, Py_buffer *view)
+{
+	PyMem_Free(view->internal);
+	view->internal = nullptr;
+}
+
+Py_ssize_t py_ue_float_records_from_buffer(PyObject *py_obj, int32 components, Py_buffer *view)
+{
+	if (!PyObject_CheckBuffer(py_obj))
+		return -1;
+
+	if (PyObject_GetBuffer(py_obj, view, PyBUF_RECORDS_RO) < 0)
+	{
+		PyErr_Clear();
+		return -1;
+	}
+
+	const char *format = view->format ? view->format : "B";
+	if (format[0] == '@' || format[0] == '=' || format[0] == '<')
+		format++;
+
+	if (format[0] != 'f' || format[1] != 0 || view->itemsize != sizeof(float) || !PyBuffer_IsContiguous(view, 'C') ||
+		(view->ndim > 1 && view->shape[view->ndim - 1] != components) || (view->len / sizeof(float)) % components != 0)
+	{
+		PyBuffer_Release(view);
+		return -1;
+	}
+
+	return (view->len / sizeof(float)) / components;
+}
+
+PyObject *py_ue_new_float_results(const TArray<float> &values)
+{
+#if PY_MAJOR_VERSION >= 3
+	PyObject *py_bytes = PyByteArray_FromStringAndSize((char *)values.GetData(), values.Num() * sizeof(float));
+	if (!py_bytes)
+		return nullptr;
+	PyObject *py_view = PyMemoryView_FromObject(py_bytes);
+	Py_DECREF(py_bytes);
+	if (!py_view)
+		return nullptr;
+	PyObject *py_ret = PyObject_CallMethod(py_view, (char *)"cast", (char *)"s", "f");
+	Py_DECREF(py_view);
+	return py_ret;
+#else
+	PyObject *py_list = PyList_New(values.Num());
+	for (int32 i = 0; i < values.Num(); i++)
+	{
+		PyList_SET_ITEM(py_list, i, PyFloat_FromDouble(values[i]));
+	}
+	return py_list;
+#endif
+}
+
+bool py_ue_float3_operand(PyObject *py_obj, FVector &value)
+{
+	if (ue_PyFVector *py_vec = py_ue_is_fvector(py_obj))
+	{
+		value = py_vec->vec;
+		return true;
+	}
+
+	if (PyNumber_Check(py_obj) && !PyObject_CheckBuffer(py_obj))
+	{
+		PyObject *f_value = PyNumber_Float(py_obj);
+		if (!f_value)
+		{
+			PyErr_Clear();
+			return false;
+		}
+		float f = PyFloat_AsDouble(f_value);
+		Py_DECREF(f_value);
+		value = FVector(f, f, f);
+		return true;
+	}
+
+	return false;
+}
+
+template<typename OpType>
+static void ue_py_float3_batch_kernel(const float *a, const float *b, int32 b_stride, float *out, int32 num, OpType Op)
+{
+	for (int32 i = 0; i < num; i++)
+	{
+		VectorRegister A = VectorLoadFloat3(a + i * 3);
+		VectorRegister B = VectorLoadFloat3(b + i * b_stride);
+		VectorStoreFloat3(Op(A, B), out + i * 3);
+	}
+}
+
+void py_ue_float3_batch_op(char op, const float *a, const float *b, int32 b_stride, float *out, int32 num)
+{
+	switch (op)
+	{
+	case '+':
+		ue_py_float3_batch_kernel(a, b, b_stride, out, num, [](const VectorRegister &A, const VectorRegister &B) { return VectorAdd(A, B); });
+		break;
+	case '-':
+		ue_py_float3_batch_kernel(a, b, b_stride, out, num, [](const VectorRegister &A, const VectorRegister &B) { return VectorSubtract(A, B); });
+		break;
+	case '*':
+		ue_py_float3_batch_kernel(a, b, b_stride, out, num, [](const VectorRegister &A, const VectorRegister &B) { return VectorMultiply(A, B); });
+		break;
+	}
+}
+
+// FVectorArray
+
+static bool ue_py_fvector_array_operand(ue_PyFVectorArray *self, PyObject *py_obj, const float *&data, int32 &stride, FVector &broadcast)
+{
+	if (ue_PyFVectorArray *py_other = py_ue_is_fvector_array(py_obj))
+	{
+		if (py_other->vecs.Num() != self->vecs.Num())
+		{
+			PyErr_Format(PyExc_ValueError, "FVectorArray length mismatch (%d and %d)", self->vecs.Num(), py_other->vecs.Num());
+			return false;
+		}
+		data = (const float *)py_other->vecs.GetData();
+		stride = 3;
+		return true;
+	}
+
+	if (py_ue_float3_operand(py_obj, broadcast))
+	{
+		data = &broadcast.X;
+		stride = 0;
+		return true;
+	}
+
+	PyErr_Format(PyExc_TypeError, "argument is not a FVectorArray, a FVector or a number");
+	return false;
+}
+
+static PyObject *py_ue_fvector_array_dot(ue_PyFVectorArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:dot", &py_obj))
+		return nullptr;
+
+	const float *data;
+	int32 stride;
+	FVector broadcast;
+	if (!ue_py_fvector_array_operand(self, py_obj, data, stride, broadcast))
+		return nullptr;
+
+	TArray<float> results;
+	results.SetNumUninitialized(self->vecs.Num());
+	const float *vecs = (const float *)self->vecs.GetData();
+	for (int32 i = 0; i < results.Num(); i++)
+	{
+		VectorRegister Dot = VectorDot3(VectorLoadFloat3(vecs + i * 3), VectorLoadFloat3(data + i * stride));
+		results[i] = VectorGetComponent(Dot, 0);
+	}
+	return py_ue_new_float_results(results);
+}
+
+static PyObject *py_ue_fvector_array_cross(ue_PyFVectorArray *self, PyObject * args)
+{
+	PyObject *py_obj;
+	if (!PyArg_ParseTuple(args, "O:cross", &py_obj))
+		return nullptr;
+
+	const float *data;
+	int32 stride;
+	FVector broadcast;
+	if (!ue_py_fvector_array_operand(self, py_obj, data, stride, broadcast))
+		return nullptr;
+
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->vecs.Num());
+	const float *vecs = (const float *)self->vecs.GetData();
+	float *out = (float *)py_ret->vecs.GetData();
+	for (int32 i = 0; i < self->vecs.Num(); i++)
+	{
+		VectorStoreFloat3(VectorCross(VectorLoadFloat3(vecs + i * 3), VectorLoadFloat3(data + i * stride)), out + i * 3);
+	}
+	return (PyObject *)py_ret;
+}
+
+static void ue_py_fvector_array_lengths(ue_PyFVectorArray *self, TArray<float> &results, bool squared)
+{
+	results.SetNumUninitialized(self->vecs.Num());
+	const float *vecs = (const float *)self->vecs.GetData();
+	for (int32 i = 0; i < results.Num(); i++)
+	{
+		VectorRegister V = VectorLoadFloat3(vecs + i * 3);
+		VectorRegister Dot = VectorDot3(V, V);
+		float size_squared = VectorGetComponent(Dot, 0);
+		results[i] = squared ? size_squared : FMath::Sqrt(size_squared);
+	}
+}
+
+static PyObject *py_ue_fvector_array_length(ue_PyFVectorArray *self, PyObject * args)
+{
+	TArray<float> results;
+	ue_py_fvector_array_lengths(self, results, false);
+	return py_ue_new_float_results(results);
+}
+
+static PyObject *py_ue_fvector_array_length_squared(ue_PyFVectorArray *self, PyObject * args)
+{
+	TArray<float> results;
+	ue_py_fvector_array_lengths(self, results, true);
+	return py_ue_new_float_results(results);
+}
+
+// same results of FVector::GetSafeNormal(): vectors with squared length below SMALL_NUMBER become zero vectors
+static void ue_py_fvector_array_normalize(const FVector *src, FVector *dst, int32 num)
+{
+	for (int32 i = 0; i < num; i++)
+	{
+		VectorRegister V = VectorLoadFloat3(&src[i].X);
+		VectorRegister SizeSquared = VectorDot3(V, V);
+		float SquareSum = VectorGetComponent(SizeSquared, 0);
+		if (SquareSum == 1.f)
+		{
+			// already normalized, copied as is
+		}
+		else if (SquareSum < SMALL_NUMBER)
+		{
+			V = VectorZero();
+		}
+		else
+		{
+			V = VectorMultiply(V, VectorReciprocalSqrtAccurate(SizeSquared));
+		}
+		VectorStoreFloat3(V, &dst[i].X);
+	}
+}
+
+static PyObject *py_ue_fvector_array_normalize(ue_PyFVectorArray *self, PyObject * args)
+{
+	ue_py_fvector_array_normalize(self->vecs.GetData(), self->vecs.GetData(), self->vecs.Num());
+	Py_RETURN_NONE;
+}
+
+static PyObject *py_ue_fvector_array_normalized(ue_PyFVectorArray *self, PyObject * args)
+{
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->vecs.Num());
+	ue_py_fvector_array_normalize(self->vecs.GetData(), py_ret->vecs.GetData(), self->vecs.Num());
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_fvector_array_copy(ue_PyFVectorArray *self, PyObject * args)
+{
+	ue_PyFVectorArray *py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(0);
+	py_ret->vecs = self->vecs;
+	return (PyObject *)py_ret;
+}
+
+static PyObject *py_ue_fvector_array_to_list(ue_PyFVectorArray *self, PyObject * args)
+{
+	PyObject *py_list = PyList_New(self->vecs.Num());
+	for (int32 i = 0; i < self->vecs.Num(); i++)
+	{
+		PyList_SET_ITEM(py_list, i, py_ue_new_fvector(self->vecs[i]));
+	}
+	return py_list;
+}
+
+static PyMethodDef ue_PyFVectorArray_methods[] = {
+	{ "dot", (PyCFunction)py_ue_fvector_array_dot, METH_VARARGS, "" },
+	{ "cross", (PyCFunction)py_ue_fvector_array_cross, METH_VARARGS, "" },
+	{ "length", (PyCFunction)py_ue_fvector_array_length, METH_VARARGS, "" },
+	{ "size", (PyCFunction)py_ue_fvector_array_length, METH_VARARGS, "" },
+	{ "length_squared", (PyCFunction)py_ue_fvector_array_length_squared, METH_VARARGS, "" },
+	{ "size_squared", (PyCFunction)py_ue_fvector_array_length_squared, METH_VARARGS, "" },
+	{ "normalize", (PyCFunction)py_ue_fvector_array_normalize, METH_VARARGS, "" },
+	{ "normalized", (PyCFunction)py_ue_fvector_array_normalized, METH_VARARGS, "" },
+	{ "copy", (PyCFunction)py_ue_fvector_array_copy, METH_VARARGS, "" },
+	{ "to_list", (PyCFunction)py_ue_fvector_array_to_list, METH_VARARGS, "" },
+	{ NULL }  /* Sentinel */
+};
+
+static PyObject *ue_PyFVectorArray_str(ue_PyFVectorArray *self)
+{
+	return PyUnicode_FromFormat("<unreal_engine.FVectorArray {'len': %d}>", self->vecs.Num());
+}
+
+static void ue_py_fvector_array_dealloc(ue_PyFVectorArray *self)
+{
+	self->vecs.~TArray<FVector>();
+	Py_TYPE(self)->tp_free((PyObject *)self);
+}
+
+static PyObject *ue_py_fvector_array_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
+{
+	ue_PyFVectorArray *self = (ue_PyFVectorArray *)type->tp_alloc(type, 0);
+	if (self)
+	{
+		new(&self->vecs) TArray<FVector>();
+		self->exports = 0;
+	}
+	return (PyObject *)self;
+}
+
+static int ue_py_fvector_array_init(ue_PyFVectorArray *self, PyObject *args, PyObject *kwargs)
+{
+	PyObject *py_obj = nullptr;
+	if (!PyArg_ParseTuple(args, "|O", &py_obj))
+		return -1;
+
+	if (self->exports > 0)
+	{
+		PyErr_SetString(PyExc_BufferError, "FVectorArray is exporting buffers");
+		return -1;
+	}
+
+	if ((PyObject *)self == py_obj)
+		return 0;
+
+	self->vecs.Empty();
+
+	if (!py_obj)
+		return 0;
+
+	// FVectorArray(size)
+	if (PyNumber_Check(py_obj) && !PyObject_CheckBuffer(py_obj) && !PySequence_Check(py_obj))
+	{
+		PyObject *py_long = PyNumber_Long(py_obj);
+		if (!py_long)
+			return -1;
+		long num = PyLong_AsLong(py_long);
+		Py_DECREF(py_long);
+		if (num < 0)
+		{
+			PyErr_SetString(PyExc_ValueError, "FVectorArray size cannot be negative");
+			return -1;
+		}
+		self->vecs.AddZeroed(num);
+		return 0;
+	}
+
+	// float32 buffer with (len, 3) shape
+	Py_buffer view;
+	Py_ssize_t num = py_ue_float_records_from_buffer(py_obj, 3, &view);
+	if (num >= 0)
+	{
+		self->vecs.SetNumUninitialized(num);
+		FMemory::Memcpy(self->vecs.GetData(), view.buf, view.len);
+		PyBuffer_Release(&view);
+		return 0;
+	}
+
+	// sequence of FVector
+	PyObject *py_fast = PySequence_Fast(py_obj, "argument is not a size, a float32 buffer or a sequence of FVector");
+	if (!py_fast)
+		return -1;
+
+	Py_ssize_t py_len = PySequence_Fast_GET_SIZE(py_fast);
+	PyObject **py_items = PySequence_Fast_ITEMS(py_fast);
+	self->vecs.SetNumUninitialized(py_len);
+	for (Py_ssize_t i = 0; i < py_len; i++)
+	{
+		ue_PyFVector *py_vec = py_ue_is_fvector(py_items[i]);
+		if (!py_vec)
+		{
+			Py_DECREF(py_fast);
+			self->vecs.Empty();
+			PyErr_Format(PyExc_TypeError, "item %d is not a FVector", (int)i);
+			return -1;
+		}
+		self->vecs[i] = py_vec->vec;
+	}
+	Py_DECREF(py_fast);
+	return 0;
+}
+
+static Py_ssize_t ue_py_fvector_array_seq_length(ue_PyFVectorArray *self)
+{
+	return self->vecs.Num();
+}
+
+static PyObject *ue_py_fvector_array_seq_item(ue_PyFVectorArray *self, Py_ssize_t i)
+{
+	if (i < 0 || i >= self->vecs.Num())
+		return PyErr_Format(PyExc_IndexError, "FVectorArray index out of range");
+	return py_ue_new_fvector(self->vecs[i]);
+}
+
+static int ue_py_fvector_array_seq_ass_item(ue_PyFVectorArray *self, Py_ssize_t i, PyObject *value)
+{
+	if (i < 0 || i >= self->vecs.Num())
+	{
+		PyErr_SetString(PyExc_IndexError, "FVectorArray index out of range");
+		return -1;
+	}
+	ue_PyFVector *py_vec = value ? py_ue_is_fvector(value) : nullptr;
+	if (!py_vec)
+	{
+		PyErr_SetString(PyExc_TypeError, "value is not a FVector");
+		return -1;
+	}
+	self->vecs[i] = py_vec->vec;
+	return 0;
+}
+
+static PyObject *ue_py_fvector_array_binary_op(PyObject *a, PyObject *b, char op, bool inplace)
+{
+	ue_PyFVectorArray *self = py_ue_is_fvector_array(a);
+	if (!self)
+	{
+		// number + FVectorArray, FVector * FVectorArray...
+		if (op == '-')
+		{
+			Py_INCREF(Py_NotImplemented);
+			return Py_NotImplemented;
+		}
+		self = py_ue_is_fvector_array(b);
+		b = a;
+	}
+
+	const float *data;
+	int32 stride;
+	FVector broadcast;
+	if (!ue_py_fvector_array_operand(self, b, data, stride, broadcast))
+	{
+		if (PyErr_ExceptionMatches(PyExc_TypeError))
+		{
+			PyErr_Clear();
+			Py_INCREF(Py_NotImplemented);
+			return Py_NotImplemented;
+		}
+		return nullptr;
+	}
+
+	ue_PyFVectorArray *py_ret = self;
+	if (inplace)
+	{
+		Py_INCREF(py_ret);
+	}
+	else
+	{
+		py_ret = (ue_PyFVectorArray *)py_ue_new_fvector_array(self->vecs.Num());
+	}
+
+	py_ue_float3_batch_op(op, (const float *)self->vecs.GetData(), data, stride, (float *)py_ret->vecs.GetData(), self->vecs.Num());
+	return (PyObject *)py_ret;
+}
+
+static PyObject *ue_py_fvector_array_add(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_binary_op(a, b, '+', false);
+}
+
+static PyObject *ue_py_fvector_array_sub(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_binary_op(a, b, '-', false);
+}
+
+static PyObject *ue_py_fvector_array_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_binary_op(a, b, '*', false);
+}
+
+static PyObject *ue_py_fvector_array_inplace_add(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_binary_op(a, b, '+', true);
+}
+
+static PyObject *ue_py_fvector_array_inplace_sub(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_binary_op(a, b, '-', true);
+}
+
+static PyObject *ue_py_fvector_array_inplace_mul(PyObject *a, PyObject *b)
+{
+	return ue_py_fvector_array_binary_op(a, b, '*', true);
+}
+
+static int ue_py_fvector_array_getbuffer(ue_PyFVectorArray *self, Py_buffer *view, int flags)
+{
+	if (py_ue_float_records_getbuffer((PyObject *)self, (float *)self->vecs.GetData(), self->vecs.Num(), 3, view, flags) < 0)
+		return -1;
+	self->exports++;
+	return 0;
+}
+
+static void ue_py_fvector_array_releasebuffer(ue_PyFVectorArray *self, Py_buffer *view)
+{
+	py_ue_float_records_releasebuffer((PyObject *)self, view);
+	self->exports--;
+}
+
+static PyNumberMethods ue_PyFVectorArray_number_methods;
+static PySequenceMethods ue_PyFVectorArray_sequence_methods;
+static PyBufferProcs ue_PyFVectorArray_buffer_procs;
+
+static PyTypeObject ue_PyFVectorArrayType = {
+	PyVarObject_HEAD_INIT(NULL, 0)
+	"unreal_engine.FVectorArray", /* tp_name */
+	sizeof(ue_PyFVectorArray), /* tp_basicsize */
+	0,                         /* tp_itemsize */
+	(destructor)ue_py_fvector_array_dealloc, /* tp_dealloc */
+	0,                         /* tp_print */
+	0,                         /* tp_getattr */
+	0,                         /* tp_setattr */
+	0,                         /* tp_reserved */
+	0,                         /* tp_repr */
+	0,                         /* tp_as_number */
+	0,                         /* tp_as_sequence */
+	0,                         /* tp_as_mapping */
+	0,                         /* tp_hash  */
+	0,                         /* tp_call */
+	(reprfunc)ue_PyFVectorArray_str, /* tp_str */
+	0,                         /* tp_getattro */
+	0,                         /* tp_setattro */
+	0,                         /* tp_as_buffer */
+#if PY_MAJOR_VERSION < 3
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_CHECKTYPES | Py_TPFLAGS_HAVE_NEWBUFFER | Py_TPFLAGS_HAVE_INPLACEOPS, /* tp_flags */
+#else
+	Py_TPFLAGS_DEFAULT,        /* tp_flags */
+#endif
+	"Unreal Engine FVectorArray", /* tp_doc */
+	0,                         /* tp_traverse */
+	0,                         /* tp_clear */
+	0,                         /* tp_richcompare */
+	0,                         /* tp_weaklistoffset */
+	0,                         /* tp_iter */
+	0,                         /* tp_iternext */
+	ue_PyFVectorArray_methods, /* tp_methods */
+	0,                         /* tp_members */
+	0,                         /* tp_getset */
+};
+
+void ue_python_init_fvector_array(PyObject *ue_module)
+{
+	ue_PyFVectorArrayType.tp_new = ue_py_fvector_array_new;
+	ue_PyFVectorArrayType.tp_init = (initproc)ue_py_fvector_array_init;
+
+	memset(&ue_PyFVectorArray_number_methods, 0, sizeof(PyNumberMethods));
+	ue_PyFVectorArrayType.tp_as_number = &ue_PyFVectorArray_number_methods;
+	ue_PyFVectorArray_number_methods.nb_add = (binaryfunc)ue_py_fvector_array_add;
+	ue_PyFVectorArray_number_methods.nb_subtract = (binaryfunc)ue_py_fvector_array_sub;
+	ue_PyFVectorArray_number_methods.nb_multiply = (binaryfunc)ue_py_fvector_array_mul;
+	ue_PyFVectorArray_number_methods.nb_inplace_add = (binaryfunc)ue_py_fvector_array_inplace_add;
+	ue_PyFVectorArray_number_methods.nb_inplace_subtract = (binaryfunc)ue_py_fvector_array_inplace_sub;
+	ue_PyFVectorArray_number_methods.nb_inplace_multiply = (binaryfunc)ue_py_fvector_array_inplace_mul;
+
+	memset(&ue_PyFVectorArray_sequence_methods, 0, sizeof(PySequenceMethods));
+	ue_PyFVectorArrayType.tp_as_sequence = &ue_PyFVectorArray_sequence_methods;
+	ue_PyFVectorArray_sequence_methods.sq_length = (lenfunc)ue_py_fvector_array_seq_length;
+	ue_PyFVectorArray_sequence_methods.sq_item = (ssizeargfunc)ue_py_fvector_array_seq_item;
+	ue_PyFVectorArray_sequence_methods.sq_ass_item = (ssizeobjargproc)ue_py_fvector_array_seq_ass_item;
+
+	memset(&ue_PyFVectorArray_buffer_procs, 0, sizeof(PyBufferProcs));
+	ue_PyFVectorArrayType.tp_as_buffer = &ue_PyFVectorArray_buffer_procs;
+	ue_PyFVectorArray_buffer_procs.bf_getbuffer = (getbufferproc)ue_py_fvector_array_getbuffer;
+	ue_PyFVectorArray_buffer_procs.bf_releasebuffer = (releasebufferproc)ue_py_fvector_array_releasebuffer;
+
+	if (PyType_Ready(&ue_PyFVectorArrayType) < 0)
+		return;
+
+	Py_INCREF(&ue_PyFVectorArrayType);
+	PyModule_AddObject(ue_module, "FVectorArray", (PyObject *)&ue_PyFVectorArrayType);
+}
+
+PyObject *py_ue_new_fvector_array(int32 num)
+{
+	ue_PyFVectorArray *ret = (ue_PyFVectorArray *)PyObject_New(ue_PyFVectorArray, &ue_PyFVectorArrayType);
+	new(&ret->vecs) TArray<FVector>();
+	ret->vecs.AddZeroed(num);
+	ret->exports = 0;
+	return (PyObject *)ret;
+}
+
+ue_PyFVectorArray *py_ue_is_fvector_array(PyObject *obj)
+{
+	if (!PyObject_IsInstance(obj, (PyObject *)&ue_PyFVectorArrayType))
+		return nullptr;
+	return (ue_PyFVectorArray *)obj;
+}
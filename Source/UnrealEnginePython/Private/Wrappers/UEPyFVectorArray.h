@@ -0,0 +1,31 @@
+#pragma once
+
+#include "UEPyModule.h"
+
+typedef struct
+{
+	PyObject_HEAD
+		/* Type-specific fields go here. */
+		TArray<FVector> vecs;
+	// number of exported buffers (the array cannot be reallocated while > 0)
+	int32 exports;
+} ue_PyFVectorArray;
+
+PyObject *py_ue_new_fvector_array(int32);
+ue_PyFVectorArray *py_ue_is_fvector_array(PyObject *);
+
+void ue_python_init_fvector_array(PyObject *);
+
+// helpers shared by the batch types (FVectorArray, FRotatorArray, FTransformArray), items are packed floats
+
+// exposes num * components floats as a (num, components) writable buffer
+int py_ue_float_records_getbuffer(PyObject *, float *, int32, int32, Py_buffer *, int);
+void py_ue_float_records_releasebuffer(PyObject *, Py_buffer *);
+// add, sub or mul ('+', '-', '*') of packed float triplets (b is broadcasted when its stride is 0, out can be a)
+void py_ue_float3_batch_op(char, const float *, const float *, int32, float *, int32);
+// returns the number of records of a contiguous float32 buffer (-1 if the object is not compatible, no python error is set)
+Py_ssize_t py_ue_float_records_from_buffer(PyObject *, int32, Py_buffer *);
+// one float per record, exposed as a memoryview (a list on python 2)
+PyObject *py_ue_new_float_results(const TArray<float> &);
+// parses a broadcastable operand (FVector or number), returns false if the object is not compatible
+bool py_ue_float3_operand(PyObject *, FVector &);
@@ -41,6 +41,18 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Python")
 	bool PythonDisableAutoBinding;
 
+	// tick the python instance from the batched tick manager (the native actor tick is disabled)
+	UPROPERTY(EditAnywhere, Category = "Python")
+	bool PythonTickBatched;
+
+	// minimum seconds between two python ticks (0 for every frame), the elapsed time is passed to tick
+	UPROPERTY(EditAnywhere, Category = "Python")
+	float PythonTickInterval;
+
+	// reduce the batched tick rate with the distance from the players (see unreal_engine.set_python_tick_lod)
+	UPROPERTY(EditAnywhere, Category = "Python")
+	bool PythonTickLOD;
+
 	UFUNCTION(BlueprintCallable, Category = "Python")
 	void CallPythonPawnMethod(FString method_name);
 
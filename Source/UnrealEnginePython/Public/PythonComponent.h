@@ -37,6 +37,18 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
 		bool PythonDisableAutoBinding;
 
+	// tick the python instance from the batched tick manager (the native component tick is disabled, not compatible with PythonTickEnableGenerator)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
+		bool PythonTickBatched;
+
+	// minimum seconds between two python ticks (0 for every frame), the elapsed time is passed to tick
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
+		float PythonTickInterval;
+
+	// reduce the batched tick rate with the distance from the players (see unreal_engine.set_python_tick_lod)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
+		bool PythonTickLOD;
+
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Python")
 		bool PythonTickEnableGenerator;
 
@@ -3,6 +3,13 @@
 #include "UnrealEnginePython.h"
 #include "PythonDelegate.generated.h"
 
+// a signature parameter with its converter, resolved once in SetSignature
+struct FPyDelegateParam
+{
+	UProperty *Property;
+	PyObject *(*ToPython)(UProperty *, uint8 *, int32);
+};
+
 UCLASS()
 class UPythonDelegate : public UObject
 {
@@ -15,6 +22,11 @@ public:
 	void SetPyCallable(PyObject *callable);
     bool UsesPyCallable(PyObject *callable);
 	void SetSignature(UFunction *original_signature);
+	// when enabled, the events of a frame are delivered at its end as a single call with a list of argument tuples
+	void SetCoalesce(bool enabled);
+	void FlushPendingEvents();
+	// delivers the coalesced events of all the delegates (automatically called at the end of each frame)
+	static void FlushCoalescedDelegates();
 
 	void PyInputHandler();
 	void PyInputAxisHandler(float value);
@@ -28,6 +40,16 @@ protected:
 
 	PyObject *py_callable;
 
+	TArray<FPyDelegateParam> params;
+	// reused when the callee does not keep a reference to it
+	PyObject *py_args_cache;
+	bool args_cache_in_use;
+
+	bool coalesce;
+	// list of argument tuples waiting for the end of the frame
+	PyObject *py_pending_events;
+
+	PyObject *BuildArgs(void *Parms, bool reuse);
 
 };
 
@@ -3,25 +3,51 @@
 #include "UnrealEnginePython.h"
 #include "UObject/UObjectGlobals.h"
 #include "UObject/WeakObjectPtr.h"
+#include "UObject/UObjectArray.h"
 #include "Widgets/SWidget.h"
 #include "Slate/UEPySlateDelegate.h"
 #include "Runtime/CoreUObject/Public/UObject/GCObject.h"
 #include "PythonDelegate.h"
 #include "PythonSmartDelegate.h"
 
-class FUnrealEnginePythonHouseKeeper : public FGCObject
+#include <atomic>
+
+class FUnrealEnginePythonHouseKeeper : public FGCObject, public FUObjectArray::FUObjectDeleteListener
 {
     struct FPythonUOjectTracker
     {
         FWeakObjectPtr Owner;
         ue_PyUObject *PyUObject;
         bool bPythonOwned;
+        // the object could be already destroyed when the tracker is removed
+        int32 ObjectIndex;
 
         FPythonUOjectTracker(UObject *Object, ue_PyUObject *InPyUObject)
         {
             Owner = FWeakObjectPtr(Object);
             PyUObject = InPyUObject;
             bPythonOwned = false;
+            ObjectIndex = GUObjectArray.ObjectToIndex(Object);
+        }
+    };
+
+    // identifies the delegates bound to the same owner with the same callable (see UPythonDelegate::UsesPyCallable)
+    struct FPythonDelegateKey
+    {
+        UObject *Owner;
+        void *CallableFunction;
+        void *CallableTarget;
+
+        FPythonDelegateKey(UObject *DelegateOwner, PyObject *PyCallable);
+
+        bool operator==(const FPythonDelegateKey &Other) const
+        {
+            return Owner == Other.Owner && CallableFunction == Other.CallableFunction && CallableTarget == Other.CallableTarget;
+        }
+
+        friend uint32 GetTypeHash(const FPythonDelegateKey &Key)
+        {
+            return HashCombine(HashCombine(PointerHash(Key.Owner), PointerHash(Key.CallableFunction)), PointerHash(Key.CallableTarget));
         }
     };
 
@@ -29,8 +55,10 @@ class FUnrealEnginePythonHouseKeeper : public FGCObject
     {
         FWeakObjectPtr Owner;
         UPythonDelegate *Delegate;
+        // the owner could be already destroyed when the tracker is removed, so the key is stored
+        FPythonDelegateKey Key;
 
-        FPythonDelegateTracker(UPythonDelegate *DelegateToTrack, UObject *DelegateOwner) : Owner(DelegateOwner), Delegate(DelegateToTrack)
+        FPythonDelegateTracker(UPythonDelegate *DelegateToTrack, UObject *DelegateOwner, const FPythonDelegateKey &DelegateKey) : Owner(DelegateOwner), Delegate(DelegateToTrack), Key(DelegateKey)
         {
         }
 
@@ -55,17 +83,48 @@ class FUnrealEnginePythonHouseKeeper : public FGCObject
 
 public:
 
+	FUnrealEnginePythonHouseKeeper();
+
 	virtual void AddReferencedObjects(FReferenceCollector& InCollector) override;
 	static FUnrealEnginePythonHouseKeeper *Get();
 	int32 RunGC();
-	bool IsValidPyUObject(ue_PyUObject *PyUObject);
+
+	// FUObjectDeleteListener (can be called by the async purge thread)
+	virtual void NotifyUObjectDeleted(const UObjectBase *Object, int32 Index) override;
+#if ENGINE_MINOR_VERSION >= 22
+	virtual void OnUObjectArrayShutdown() override;
+#endif
+
+	// in incremental mode dead wrappers (reported by the delete listener) and delegates are released
+	// by a core ticker, within the specified time and entries budget per frame, instead of by a full scan after every GC
+	void SetIncrementalGC(bool bEnabled, float BudgetMilliseconds, int32 MaxEntries);
+	PyObject *GetGCStats();
+
+	// no hash lookup: the wrapper must be the one registered for its object index and the index serial number must match
+	FORCEINLINE bool IsValidPyUObject(ue_PyUObject *PyUObject)
+	{
+		if (!PyUObject || PyUObject->object_index < 0 || FindPyUObjectByIndex(PyUObject->object_index) != PyUObject)
+			return false;
+
+		FUObjectItem *ObjectItem = GUObjectArray.IndexToObject(PyUObject->object_index);
+		if (!ObjectItem || ObjectItem->Object != PyUObject->ue_object || ObjectItem->GetSerialNumber() != PyUObject->object_serial)
+			return false;
+
+		// same rules of FWeakObjectPtr::IsValid()
+		return !ObjectItem->IsPendingKill() && !ObjectItem->IsUnreachable();
+	}
+
 	void TrackUObject(UObject *Object);
 	void UntrackUObject(UObject *Object);
 	void RegisterPyUObject(UObject *Object, ue_PyUObject *InPyUObject);
 	void UnregisterPyUObject(UObject *Object);
+	// called when a python owned wrapper is destroyed
+	void ForgetPyUObject(ue_PyUObject *PyUObject);
 	ue_PyUObject *GetPyUObject(UObject *Object);
 	UPythonDelegate *FindDelegate(UObject *Owner, PyObject *PyCallable);
 	UPythonDelegate *NewDelegate(UObject *Owner, PyObject *PyCallable, UFunction *Signature);
+	// releases the most recent delegate (already unbound) of the owner using the callable, returns false if not tracked
+	bool UntrackDelegate(UObject *Owner, PyObject *PyCallable);
 	TSharedRef<FPythonSlateDelegate> NewSlateDelegate(TSharedRef<SWidget> Owner, PyObject *PyCallable);
 	TSharedRef<FPythonSlateDelegate> NewDeferredSlateDelegate(PyObject *PyCallable);
 	TSharedRef<FPythonSmartDelegate> NewPythonSmartDelegate(PyObject *PyCallable);
@@ -73,12 +132,57 @@ public:
 	TSharedRef<FPythonSlateDelegate> NewStaticSlateDelegate(PyObject *PyCallable);
 
 private:
+	// object index -> registered wrapper, allocated in chunks (like GUObjectArray) on demand.
+	// The chunks table is never reallocated. The delete listener reads it from the async purge thread
+	// while the game thread publishes new chunks and wrappers, so both are atomics: chunks are published
+	// with release semantics (their zeroed memory is visible before the pointer) and read with acquire.
+	enum { PyUObjectsChunkSize = 64 * 1024, PyUObjectsMaxChunks = MAX_int32 / PyUObjectsChunkSize + 1 };
+	typedef std::atomic<ue_PyUObject *> FPyUObjectSlot;
+	std::atomic<FPyUObjectSlot *> PyUObjectsChunks[PyUObjectsMaxChunks];
+
+	FORCEINLINE ue_PyUObject *FindPyUObjectByIndex(int32 Index) const
+	{
+		FPyUObjectSlot *Chunk = PyUObjectsChunks[Index / PyUObjectsChunkSize].load(std::memory_order_acquire);
+		if (!Chunk)
+			return nullptr;
+		// a plain load on the game thread, the listener only checks if a wrapper exists
+		return Chunk[Index % PyUObjectsChunkSize].load(std::memory_order_relaxed);
+	}
+	void SetPyUObjectByIndex(int32 Index, ue_PyUObject *PyUObject);
+
 	void RunGCDelegate();
 	uint32 PyUObjectsGC();
 	int32 DelegatesGC();
+	void RemoveDelegateTracker(int32 Index);
+
+	bool IncrementalGCTick(float DeltaTime);
+	bool ReleaseDeadPyUObject(UObject *Object);
+
+	// read by the delete listener (any thread)
+	std::atomic<bool> bIncrementalGC;
+	double GCBudgetSeconds;
+	int32 GCMaxEntries;
+	FDelegateHandle GCTickerHandle;
+
+	// filled by the delete listener
+	FCriticalSection DeadObjectsLock;
+	TArray<UObject *> DeadObjects;
+	// game thread copy, processed by the ticker
+	TArray<UObject *> PendingDeadObjects;
+	int32 PendingDeadObjectsCursor;
+	// delegates are scanned after every GC, starting from the end of the arrays
+	int32 DelegatesCursor;
+	int32 SlateDelegatesCursor;
+
+	uint64 GCScanned;
+	uint64 GCFreed;
+	double GCSeconds;
+	double GCLastFrameSeconds;
 
 	TMap<UObject *, FPythonUOjectTracker> UObjectPyMapping;
 	TArray<FPythonDelegateTracker> PyDelegatesTracker;
+	// key -> indices of PyDelegatesTracker (in bind order), updated on swap removal
+	TMap<FPythonDelegateKey, TArray<int32, TInlineAllocator<1>>> PyDelegatesIndex;
 
 	TArray<FPythonSWidgetDelegateTracker> PySlateDelegatesTracker;
 	TArray<TSharedRef<FPythonSlateDelegate>> PyStaticSlateDelegatesTracker;
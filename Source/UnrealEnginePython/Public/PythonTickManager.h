@@ -0,0 +1,115 @@
+#pragma once
+
+#include "UnrealEnginePython.h"
+#include "Engine/EngineBaseTypes.h"
+#include "UObject/WeakObjectPtr.h"
+
+class FPythonTickManager;
+struct FPythonTickBucket;
+
+// one tick function per world and tick group, calling all of the registered python instances
+struct FPythonBatchedTickFunction : public FTickFunction
+{
+	FPythonTickBucket *Bucket;
+
+	virtual void ExecuteTick(float DeltaTime, ELevelTick TickType, ENamedThreads::Type CurrentThread, const FGraphEventRef& MyCompletionGraphEvent) override;
+	virtual FString DiagnosticMessage() override;
+};
+
+struct FPythonTickEntry
+{
+	// the owner pointer used as the map key (the owner could be already destroyed)
+	UObject *Key;
+	FWeakObjectPtr Owner;
+	// the actor driving the time dilation (the owner of a component)
+	TWeakObjectPtr<AActor> Actor;
+	PyObject *PyInstance;
+	// bound 'tick' method (nullptr when the class exposes 'tick_batch')
+	PyObject *PyTick;
+	// 'tick_batch' classmethod/staticmethod of the instance class
+	PyObject *PyTickBatch;
+
+	// scheduling (ignored by 'tick_batch', the class is always called every frame)
+	// minimum seconds between two ticks (0 for every frame)
+	float TickInterval;
+	// tick every N frames (0 to use the distance based LOD, or every frame if bTickLOD is false)
+	int32 TickPeriod;
+	bool bTickLOD;
+	// round-robin slot, spreads the instances with the same period/interval across frames
+	uint32 Phase;
+	// time elapsed (dilated) since the last tick, passed as delta time
+	float AccumulatedTime;
+	// seconds taken off TickInterval until the first tick, staggers the instances without changing their delta time
+	float FirstTickOffset;
+};
+
+struct FPythonTickBatch
+{
+	PyObject *PyTickBatch;
+	// tuple of instances, rebuilt only when the bucket changes
+	PyObject *PyInstances;
+};
+
+struct FPythonTickBucket
+{
+	UWorld *World;
+	ETickingGroup TickGroup;
+	FPythonBatchedTickFunction TickFunction;
+
+	TArray<FPythonTickEntry> Entries;
+	TMap<UObject *, int32> EntriesIndex;
+
+	TArray<FPythonTickBatch> Batches;
+	bool bBatchesDirty;
+	bool bTicking;
+	bool bNeedsCompaction;
+	uint64 Frame;
+
+	void Tick(float DeltaTime);
+	int32 GetLODPeriod(const FPythonTickEntry &Entry, const TArray<FVector, TInlineAllocator<4>> &ViewLocations) const;
+	void RebuildBatches();
+	void RemoveEntry(int32 Index);
+	void Compact();
+	void Clear();
+};
+
+/*
+* Opt-in replacement of the per instance Tick of APyActor, APyPawn and UPythonComponent.
+* The GIL is taken once per world and tick group, and the bound 'tick' methods are cached.
+*/
+class UNREALENGINEPYTHON_API FPythonTickManager
+{
+public:
+	static FPythonTickManager *Get();
+
+	// returns false if the instance exposes neither 'tick' nor 'tick_batch' (the GIL must be held)
+	bool Register(UObject *Owner, PyObject *PyInstance, ETickingGroup TickGroup, float TickInterval = 0, bool bTickLOD = false);
+	// the GIL must be held
+	void Unregister(UObject *Owner);
+
+	// returns false if the object is not registered
+	bool SetSchedule(UObject *Owner, float TickInterval, int32 TickPeriod, bool bTickLOD);
+
+	// distance from the nearest player view point -> tick every N frames (sorted by distance)
+	void SetLOD(const TArray<TPair<float, int32>> &InLODs);
+
+	int32 Num() const { return OwnersBucket.Num(); }
+
+	uint64 Ticked;
+	uint64 Skipped;
+
+private:
+	friend struct FPythonTickBucket;
+
+	FPythonTickBucket *FindOrAddBucket(UWorld *World, ETickingGroup TickGroup);
+	void OnWorldCleanup(UWorld *World, bool bSessionEnded, bool bCleanupResources);
+
+	FPythonTickManager() : Ticked(0), Skipped(0), NextPhase(0) {}
+
+	TArray<FPythonTickBucket *> Buckets;
+	TMap<UObject *, FPythonTickBucket *> OwnersBucket;
+
+	// squared distances
+	TArray<TPair<float, int32>> LODs;
+	uint32 NextPhase;
+};
@@ -46,6 +46,9 @@ typedef struct
 	int auto_rooted;
 	// if owned the life of the UObject is related to the life of PyObject
 	int owned;
+	// GUObjectArray index and serial number of ue_object (assigned by the housekeeper for O(1) validity checks)
+	int32 object_index;
+	int32 object_serial;
 } ue_PyUObject;
 
 UNREALENGINEPYTHON_API void ue_py_register_magic_module(char *name, PyObject *(*)());
@@ -142,7 +142,8 @@ public class UnrealEnginePython : ModuleRules
                 "MovieSceneCapture",
                 "Landscape",
                 "Foliage",
-                "AIModule"
+                "AIModule",
+                "ImageWrapper"
 				// ... add private dependencies that you statically link with here ...
 			}
             );
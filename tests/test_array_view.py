@@ -0,0 +1,66 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine.classes import NavigationPath
+from unreal_engine import FVector
+
+
+class TestArrayView(unittest.TestCase):
+
+    def setUp(self):
+        self.path = NavigationPath()
+        self.path.PathPoints = [FVector(1, 2, 3), FVector(4, 5, 6), FVector(7, 8, 9)]
+
+    def test_view(self):
+        view = memoryview(self.path.get_property_view('PathPoints'))
+        self.assertEqual(view.shape, (3, 3))
+        self.assertEqual(view.tolist()[1], [4, 5, 6])
+        view[0, 0] = 10
+        view.release()
+        self.assertEqual(self.path.PathPoints[0].x, 10)
+
+    def test_resize_while_exported(self):
+        view = memoryview(self.path.get_property_view('PathPoints'))
+        with self.assertRaises(BufferError):
+            self.path.PathPoints = [FVector(0, 0, 0)] * 5
+        with self.assertRaises(BufferError):
+            self.path.set_property('PathPoints', [])
+        self.assertEqual(len(self.path.PathPoints), 3)
+        # same length, copied in place
+        self.path.PathPoints = [FVector(0, 0, 0)] * 3
+        self.assertEqual(view.tolist()[2], [0, 0, 0])
+        view.release()
+        self.path.PathPoints = [FVector(0, 0, 0)] * 5
+        self.assertEqual(len(self.path.PathPoints), 5)
+
+    def test_assign_own_view(self):
+        view = self.path.get_property_view('PathPoints')
+        # the source memory is the destination memory
+        self.path.PathPoints = view
+        self.assertEqual(self.path.PathPoints[2].z, 9)
+        mv = memoryview(view)
+        self.path.set_property('PathPoints', mv)
+        self.assertEqual(mv.tolist(), [[1, 2, 3], [4, 5, 6], [7, 8, 9]])
+        mv.release()
+
+    def test_assign_own_view_smaller(self):
+        mv = memoryview(self.path.get_property_view('PathPoints'))
+        # the slice still references the array, it cannot be shrunk
+        with self.assertRaises(BufferError):
+            self.path.PathPoints = mv[1:]
+        self.assertEqual(mv.tolist(), [[1, 2, 3], [4, 5, 6], [7, 8, 9]])
+        mv.release()
+
+    def test_assign_own_view_larger(self):
+        view = self.path.get_property_view('PathPoints')
+        mv = memoryview(view)
+        points = [FVector(*point) for point in mv.tolist()]
+        mv.release()
+        # grown from its own memory (no more exported), then assigned to itself
+        self.path.PathPoints = points + points
+        self.path.PathPoints = view
+        self.assertEqual(len(self.path.PathPoints), 6)
+        self.assertEqual(self.path.PathPoints[5].x, 7)
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
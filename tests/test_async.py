@@ -0,0 +1,43 @@
+import unittest
+import asyncio
+import unreal_engine as ue
+from unreal_engine.classes import Actor
+
+
+class TestAsync(unittest.TestCase):
+
+    def setUp(self):
+        self.world = ue.get_editor_world()
+        self.actor = self.world.actor_spawn(Actor)
+        self.loop = ue.get_event_loop()
+
+    def tearDown(self):
+        self.actor.actor_destroy()
+
+    def test_wait_event(self):
+        future = self.actor.wait_event('OnDestroyed')
+        self.actor.broadcast('OnDestroyed', self.actor)
+        self.assertTrue(future.done())
+        self.assertEqual(future.result(), self.actor)
+
+    def test_wait_event_repeated(self):
+        before = ue.get_housekeeper_gc_stats()['delegates']
+        for i in range(100):
+            future = self.actor.wait_event('OnDestroyed')
+            self.actor.broadcast('OnDestroyed', self.actor)
+            self.assertTrue(future.done())
+        self.assertEqual(ue.get_housekeeper_gc_stats()['delegates'], before)
+
+    def test_wait_event_cancelled(self):
+        before = ue.get_housekeeper_gc_stats()['delegates']
+        futures = [self.actor.wait_event('OnDestroyed') for i in range(10)]
+        self.assertEqual(ue.get_housekeeper_gc_stats()['delegates'], before + 10)
+        for future in futures:
+            future.cancel()
+        # done callbacks are scheduled in the loop
+        self.loop.run_until_complete(asyncio.sleep(0))
+        self.assertEqual(ue.get_housekeeper_gc_stats()['delegates'], before)
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
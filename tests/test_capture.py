@@ -0,0 +1,35 @@
+import unittest
+import asyncio
+import queue
+import unreal_engine as ue
+
+
+class TestCapture(unittest.TestCase):
+
+    # an invalid capture list stops in_editor_capture() right after the frame sink has been validated
+    invalid_captures = [None]
+
+    def test_frame_sink_invalid(self):
+        with self.assertRaisesRegex(Exception, 'frame_sink must be a callable or a queue'):
+            ue.in_editor_capture(self.invalid_captures, frame_sink=object())
+
+    def test_frame_sink_queue(self):
+        with self.assertRaisesRegex(Exception, 'iterable of UMovieSceneCapture'):
+            ue.in_editor_capture(self.invalid_captures, frame_sink=queue.Queue(maxsize=1))
+
+    def test_frame_sink_asyncio_queue(self):
+        # accepted without drop_frames, frames are put with put_nowait()
+        with self.assertRaisesRegex(Exception, 'iterable of UMovieSceneCapture'):
+            ue.in_editor_capture(self.invalid_captures, frame_sink=asyncio.Queue(maxsize=1))
+
+    def test_frame_sink_max_pending_frames(self):
+        with self.assertRaises(ValueError):
+            ue.in_editor_capture(self.invalid_captures, frame_sink=queue.Queue(), max_pending_frames=0)
+
+    def test_frame_sink_format(self):
+        with self.assertRaises(ValueError):
+            ue.in_editor_capture(self.invalid_captures, frame_sink=queue.Queue(), frame_format='gif')
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
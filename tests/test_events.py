@@ -0,0 +1,57 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine.classes import Actor
+
+
+class TestEvents(unittest.TestCase):
+
+    def setUp(self):
+        self.world = ue.get_editor_world()
+        self.actor = self.world.actor_spawn(Actor)
+        self.received = []
+
+    def tearDown(self):
+        self.actor.actor_destroy()
+
+    def on_destroyed(self, *args):
+        self.received.append(args)
+
+    def test_args_kept_between_calls(self):
+        other = self.world.actor_spawn(Actor)
+        # BaseException.__init__ stores the very tuple it is called with, so the delegate
+        # must not reuse it for the next broadcast
+        receiver = Exception()
+        kept = []
+        self.actor.bind_event('OnDestroyed', receiver.__init__)
+        self.actor.broadcast('OnDestroyed', self.actor)
+        kept.append(receiver.args)
+        self.actor.broadcast('OnDestroyed', other)
+        kept.append(receiver.args)
+        self.actor.broadcast('OnDestroyed', self.actor)
+        kept.append(receiver.args)
+        self.assertEqual(kept, [(self.actor,), (other,), (self.actor,)])
+        other.actor_destroy()
+
+    def test_args_not_kept_between_calls(self):
+        other = self.world.actor_spawn(Actor)
+        self.actor.bind_event('OnDestroyed', self.on_destroyed)
+        self.actor.broadcast('OnDestroyed', self.actor)
+        self.actor.broadcast('OnDestroyed', other)
+        self.actor.broadcast('OnDestroyed', self.actor)
+        self.assertEqual(self.received, [(self.actor,), (other,), (self.actor,)])
+        other.actor_destroy()
+
+    def test_coalesced(self):
+        batches = []
+        self.actor.bind_event('OnDestroyed', batches.append, True)
+        self.actor.broadcast('OnDestroyed', self.actor)
+        self.actor.broadcast('OnDestroyed', self.actor)
+        # delivered at the end of the frame
+        self.assertEqual(batches, [])
+        ue.flush_coalesced_events()
+        self.assertEqual(batches, [[(self.actor,), (self.actor,)]])
+        ue.flush_coalesced_events()
+        self.assertEqual(len(batches), 1)
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
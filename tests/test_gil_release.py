@@ -0,0 +1,87 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine import FARFilter
+from unreal_engine.classes import StaticMesh
+import threading
+import time
+import sys
+
+
+class Spinner(threading.Thread):
+
+    def __init__(self):
+        super().__init__(daemon=True)
+        self.counter = 0
+        self.running = True
+
+    def run(self):
+        while self.running:
+            self.counter += 1
+            # give back the GIL, so the test thread never waits for the switch interval
+            time.sleep(0.0005)
+
+
+class TestGILRelease(unittest.TestCase):
+
+    def setUp(self):
+        self.random_string = str(int(time.time()))
+        # assets created by the test, deleted in tearDown
+        self.assets = []
+        self.switch_interval = sys.getswitchinterval()
+        # the spinner can only run while the GIL is explicitly released by the bindings
+        sys.setswitchinterval(30)
+        self.spinner = Spinner()
+        self.spinner.start()
+
+    def tearDown(self):
+        self.spinner.running = False
+        self.spinner.join()
+        sys.setswitchinterval(self.switch_interval)
+        for asset in self.assets:
+            try:
+                ue.delete_asset(asset.get_path_name())
+            except:
+                pass
+
+    # only for calls known to be slow: when the native work is shorter than a thread switch
+    # the spinner could not run even if the GIL has been released
+    def assertProgress(self, func, *args, **kwargs):
+        before = self.spinner.counter
+        ret = func(*args, **kwargs)
+        self.assertGreater(self.spinner.counter, before)
+        return ret
+
+    def test_get_assets_by_filter(self):
+        ar_filter = FARFilter()
+        # the whole engine content, so the query is not instantaneous
+        ar_filter.package_paths = ['/Engine']
+        ar_filter.recursive_paths = True
+        assets = self.assertProgress(ue.get_assets_by_filter, ar_filter)
+        self.assertTrue(len(assets) > 0)
+
+    def test_static_mesh_build_and_save(self):
+        # the cube is already resident and the package is in memory: too fast for measuring the spinner
+        cube = ue.load_object(StaticMesh, '/Engine/BasicShapes/Cube.Cube')
+        mesh = cube.duplicate('/Game/Tests/GIL/Cube_' + self.random_string, 'Cube_' + self.random_string)
+        self.assets.append(mesh)
+        self.assertProgress(mesh.static_mesh_build)
+        self.assertProgress(mesh.save_package)
+        package = ue.load_package('/Game/Tests/GIL/Cube_' + self.random_string)
+        self.assertTrue(package.is_a(ue.find_class('Package')))
+
+    def test_throughput(self):
+        # the spinner keeps running while the game thread is busy in native code
+        cube = ue.load_object(StaticMesh, '/Engine/BasicShapes/Cube.Cube')
+        mesh = cube.duplicate('/Game/Tests/GIL/Cube2_' + self.random_string, 'Cube2_' + self.random_string)
+        self.assets.append(mesh)
+        before = self.spinner.counter
+        start = time.time()
+        for i in range(10):
+            mesh.static_mesh_build()
+        elapsed = time.time() - start
+        ue.log('static_mesh_build x10: {0:.3f}s, spinner iterations: {1}'.format(elapsed, self.spinner.counter - before))
+        self.assertGreater(self.spinner.counter, before)
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
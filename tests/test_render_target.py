@@ -0,0 +1,42 @@
+import unittest
+import unreal_engine as ue
+from unreal_engine.enums import EPixelFormat
+
+
+class TestRenderTarget(unittest.TestCase):
+
+    def read_async(self, render_target):
+        results = []
+        render_target.render_target_get_data_async(None, results.append)
+        ue.flush_render_target_readbacks()
+        self.assertEqual(len(results), 1)
+        return results[0]
+
+    def test_get_data_async(self):
+        render_target = ue.create_transient_texture_render_target2d(16, 8)
+        pixels = self.read_async(render_target)
+        self.assertEqual(len(pixels), 16 * 8 * 4)
+
+    def test_get_data_async_half_float(self):
+        render_target = ue.create_transient_texture_render_target2d(16, 8, EPixelFormat.PF_FloatRGBA)
+        pixels = self.read_async(render_target)
+        self.assertEqual(len(pixels), 16 * 8 * 8)
+
+    def test_get_data_async_float(self):
+        for format in (EPixelFormat.PF_FloatRGB, EPixelFormat.PF_R16F, EPixelFormat.PF_R32_FLOAT):
+            render_target = ue.create_transient_texture_render_target2d(16, 8, format)
+            pixels = self.read_async(render_target)
+            self.assertEqual(len(pixels), 16 * 8 * 16)
+
+    def test_get_data_async_buffer(self):
+        render_target = ue.create_transient_texture_render_target2d(16, 8)
+        buffer = bytearray(16 * 8 * 4)
+        results = []
+        render_target.render_target_get_data_async(buffer, results.append)
+        ue.flush_render_target_readbacks()
+        self.assertIs(results[0], buffer)
+
+    def test_get_data_async_small_buffer(self):
+        render_target = ue.create_transient_texture_render_target2d(16, 8)
+        with self.assertRaises(Exception):
+            render_target.render_target_get_data_async(bytearray(4), lambda pixels: None)
@@ -0,0 +1,49 @@
+import unittest
+import unreal_engine as ue
+
+
+class TestScreenshot(unittest.TestCase):
+
+    def screenshot(self, **kwargs):
+        # the game viewport exists only in game (or PIE), the editor one otherwise
+        result = ue.get_viewport_screenshot(**kwargs)
+        if result is None and hasattr(ue, 'editor_get_active_viewport_screenshot'):
+            result = ue.editor_get_active_viewport_screenshot(**kwargs)
+        if result is None:
+            self.skipTest('no viewport can be captured')
+        return result
+
+    def test_raw(self):
+        data, width, height, format = self.screenshot(raw=True)
+        self.assertIsInstance(data, bytearray)
+        self.assertEqual(format, 'BGRA8')
+        self.assertGreater(width, 0)
+        self.assertGreater(height, 0)
+        self.assertEqual(len(data), width * height * 4)
+
+    def test_buffer(self):
+        _, width, height, _ = self.screenshot(raw=True)
+        buffer = bytearray(b'\xaa' * (width * height * 4 + 4))
+        data, buffer_width, buffer_height, format = self.screenshot(buffer=buffer)
+        self.assertIs(data, buffer)
+        self.assertEqual((buffer_width, buffer_height, format), (width, height, 'BGRA8'))
+        # the bytes after the pixels are untouched
+        self.assertEqual(buffer[-4:], b'\xaa\xaa\xaa\xaa')
+
+    def test_buffer_too_small(self):
+        self.screenshot(raw=True)
+        with self.assertRaises(Exception):
+            self.screenshot(buffer=bytearray(4))
+
+    def test_async_without_game_viewport(self):
+        try:
+            ue.get_game_viewport_size()
+        except Exception:
+            with self.assertRaises(Exception):
+                ue.get_viewport_screenshot_async(None, lambda result: None)
+            return
+        self.skipTest('a game viewport is available')
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
@@ -0,0 +1,124 @@
+import unittest
+import struct
+import zlib
+import unreal_engine as ue
+
+
+class TestTexture(unittest.TestCase):
+
+    def test_lock_mip(self):
+        texture = ue.create_transient_texture(16, 16)
+        with texture.texture_lock_mip() as pixels:
+            self.assertEqual(len(pixels), 16 * 16 * 4)
+            pixels[0:4] = b'\x01\x02\x03\x04'
+        self.assertEqual(texture.texture_get_data()[0:4], b'\x01\x02\x03\x04')
+
+    def test_lock_mip_released(self):
+        texture = ue.create_transient_texture(16, 16)
+        with texture.texture_lock_mip() as pixels:
+            pass
+        with self.assertRaises(ValueError):
+            pixels[0] = 1
+
+    def test_lock_mip_readonly(self):
+        texture = ue.create_transient_texture(16, 16)
+        with texture.texture_lock_mip(0, False, True) as pixels:
+            self.assertTrue(pixels.readonly)
+
+    def test_lock_mip_twice(self):
+        texture = ue.create_transient_texture(16, 16)
+        with ue.texture_lock_batch() as batch:
+            batch.lock(texture, 0)
+            with self.assertRaises(Exception):
+                batch.lock(texture, 0)
+
+    def test_lock_batch(self):
+        texture0 = ue.create_transient_texture(16, 16)
+        texture1 = ue.create_transient_texture(8, 8)
+        with ue.texture_lock_batch() as batch:
+            pixels0 = batch.lock(texture0)
+            pixels1 = batch.lock(texture1)
+            pixels0[0:4] = b'\x05\x06\x07\x08'
+            pixels1[0:4] = b'\x09\x0a\x0b\x0c'
+        self.assertEqual(texture0.texture_get_data()[0:4], b'\x05\x06\x07\x08')
+        self.assertEqual(texture1.texture_get_data()[0:4], b'\x09\x0a\x0b\x0c')
+
+    def test_lock_mip_slice_exported(self):
+        texture = ue.create_transient_texture(16, 16)
+        batch = ue.texture_lock_batch()
+        pixels = batch.lock(texture)
+        head = pixels[0:4]
+        # the slice survives the release of the view, so the mip cannot be unlocked
+        with self.assertRaises(BufferError):
+            batch.commit()
+        head[0:4] = b'\x0d\x0e\x0f\x10'
+        with self.assertRaises(ValueError):
+            pixels[0]
+        head.release()
+        batch.commit()
+        self.assertEqual(texture.texture_get_data()[0:4], b'\x0d\x0e\x0f\x10')
+
+    def test_lock_batch_exported_unlocks_others(self):
+        texture0 = ue.create_transient_texture(16, 16)
+        texture1 = ue.create_transient_texture(8, 8)
+        batch = ue.texture_lock_batch()
+        pixels0 = batch.lock(texture0)
+        pixels1 = batch.lock(texture1)
+        pixels1[0:4] = b'\x11\x12\x13\x14'
+        cast = pixels0.cast('I')
+        with self.assertRaises(BufferError):
+            batch.commit()
+        # the mip that is not exported anymore has been unlocked and updated
+        self.assertEqual(texture1.texture_get_data()[0:4], b'\x11\x12\x13\x14')
+        cast.release()
+        batch.commit()
+
+    def decode_png(self, data):
+        self.assertEqual(data[0:8], b'\x89PNG\r\n\x1a\n')
+        offset = 8
+        header = None
+        idat = b''
+        while offset < len(data):
+            length, chunk_type = struct.unpack('>I4s', data[offset:offset + 8])
+            chunk = data[offset + 8:offset + 8 + length]
+            if chunk_type == b'IHDR':
+                header = struct.unpack('>IIBB', chunk[0:10])
+            elif chunk_type == b'IDAT':
+                idat += chunk
+            offset += 12 + length
+        return header, zlib.decompress(idat)
+
+    def test_compress_images(self):
+        jobs = [(4, 2, bytearray(4 * 2 * 4)), (3, 5, bytes(range(60)))]
+        results = ue.compress_images(jobs)
+        self.assertEqual(len(results), 2)
+        for (width, height, _), data in zip(jobs, results):
+            header, pixels = self.decode_png(data)
+            # 8 bit RGBA
+            self.assertEqual(header, (width, height, 8, 6))
+            # every row is prefixed by its filter type
+            self.assertEqual(len(pixels), height * (1 + width * 4))
+
+    def test_compress_images_jpeg(self):
+        data = ue.compress_images([(8, 4, bytearray(8 * 4 * 4))], 'jpeg')[0]
+        self.assertEqual(data[0:2], b'\xff\xd8')
+        offset = 2
+        while data[offset + 1] not in (0xc0, 0xc1, 0xc2):
+            offset += 2 + struct.unpack('>H', data[offset + 2:offset + 4])[0]
+        height, width = struct.unpack('>HH', data[offset + 5:offset + 9])
+        self.assertEqual((width, height), (8, 4))
+
+    def test_compress_images_overflow(self):
+        # width * height * 4 does not fit in 32 bits
+        with self.assertRaises(Exception):
+            ue.compress_images([(65536, 32768, bytearray(16))])
+        with self.assertRaises(Exception):
+            ue.compress_images([(65536, 65536, bytearray(16))])
+
+    def test_compress_images_invalid_job(self):
+        with self.assertRaises(TypeError):
+            ue.compress_images([[4, 2, bytearray(4 * 2 * 4)]])
+
+
+if __name__ == '__main__':
+    unittest.main(exit=False)
@@ -1,6 +1,7 @@
 import unittest
 import unreal_engine as ue
 from unreal_engine import FVector, FRotator, FTransform
+from unreal_engine import FVectorArray, FTransformArray
 
 class TestVector(unittest.TestCase):
 
@@ -36,4 +37,28 @@ class TestTransform(unittest.TestCase):
 		self.assertEqual( transform0.rotation.yaw, 0)
 		self.assertEqual( transform0.scale, FVector(1, 1, 1))
 
+class TestVectorArray(unittest.TestCase):
 
+	def test_add(self):
+		vectors0 = FVectorArray([FVector(1, 2, 3), FVector(4, 5, 6)])
+		vectors1 = FVectorArray([FVector(4, 5, 6), FVector(1, 2, 3)])
+		self.assertEqual( (vectors0 + vectors1).to_list(), [FVector(5, 7, 9), FVector(5, 7, 9)])
+
+	def test_scale(self):
+		vectors0 = FVectorArray([FVector(1, 2, -3), FVector(0, 1, 0)])
+		self.assertEqual( (vectors0 * 2).to_list(), [FVector(2, 4, -6), FVector(0, 2, 0)])
+
+	def test_dot(self):
+		vectors0 = FVectorArray([FVector(1, 2, 3), FVector(0, 1, 0)])
+		self.assertEqual( list(vectors0.dot(FVector(1, 1, 1))), [6, 1])
+
+	def test_normalized(self):
+		vectors0 = FVectorArray([FVector(0, 0, 10), FVector(0, 0, 0)])
+		self.assertEqual( vectors0.normalized().to_list(), [FVector(0, 0, 1), FVector(0, 0, 0)])
+
+class TestTransformArray(unittest.TestCase):
+
+	def test_identity(self):
+		transforms0 = FTransformArray(2)
+		vectors0 = FVectorArray([FVector(1, 2, 3), FVector(4, 5, 6)])
+		self.assertEqual( transforms0.transform_position(vectors0).to_list(), vectors0.to_list())
@@ -30,7 +30,21 @@ class TestUObject(unittest.TestCase):
         self.assertIsNotNone(asset)
         ue.delete_asset(asset_name)
 
-   
-
-
-
+    def test_attribute_cache(self):
+        new_material = Material()
+        ue.clear_attribute_cache()
+        before = ue.get_attribute_cache_stats()
+        first = new_material.TwoSided
+        second = new_material.TwoSided
+        self.assertEqual(first, second)
+        after = ue.get_attribute_cache_stats()
+        self.assertTrue(after['hits'] > before['hits'])
+        self.assertTrue(after['entries'] > 0)
+
+    def test_set_property_overflow(self):
+        new_material = Material()
+        with self.assertRaises(Exception):
+            new_material.set_property('NumCustomizedUVs', 2 ** 70)
+        # no python error is left pending by the failed conversion
+        new_material.set_property('NumCustomizedUVs', 2)
+        self.assertEqual(new_material.get_property('NumCustomizedUVs'), 2)